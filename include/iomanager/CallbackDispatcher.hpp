@@ -0,0 +1,114 @@
+/**
+ * @file CallbackDispatcher.hpp
+ *
+ * The CallbackDispatcher class declarations. The CallbackDispatcher runs a
+ * small shared pool of worker threads which multiplexes all registered
+ * receiver callbacks, so that the number of callback threads in an
+ * application is proportional to the number of cores rather than to the
+ * number of connections.
+ *
+ * This is part of the DUNE DAQ Application Framework, copyright 2020.
+ * Licensing/copyright details are in the COPYING file that you should have
+ * received with this code.
+ */
+
+#ifndef IOMANAGER_INCLUDE_IOMANAGER_CALLBACKDISPATCHER_HPP_
+#define IOMANAGER_INCLUDE_IOMANAGER_CALLBACKDISPATCHER_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dunedaq {
+namespace iomanager {
+
+/**
+ * @brief The CallbackDispatcher manages the event loops of all receivers
+ * with registered callbacks
+ *
+ * Receivers register a poll function which attempts one non-blocking
+ * receive and invokes the user callback on success, returning whether any
+ * work was done. The dispatcher's workers sweep over all registered poll
+ * functions, guaranteeing that each one is executed by at most one worker
+ * at a time (matching the old one-thread-per-callback serialization), and
+ * go to sleep when a full sweep finds no work.
+ */
+class CallbackDispatcher
+{
+public:
+  using poll_fn_t = std::function<bool()>; ///< Returns true if work was done
+  using handle_t = size_t;                 ///< Registration handle, 0 is invalid
+
+  ~CallbackDispatcher();
+
+  /**
+   * @brief Get a handle to the CallbackDispatcher
+   * @return CallbackDispatcher handle
+   */
+  static CallbackDispatcher& get();
+
+  /**
+   * @brief Register a poll function with the dispatcher, starting the
+   * worker pool if necessary
+   * @param poll Function attempting one non-blocking receive
+   * @param priority Scheduling priority: workers sweep higher-priority
+   * entries first and give an entry with priority p up to p+1 polls per
+   * sweep, so e.g. trigger decisions drain ahead of bulk monitoring
+   * traffic during bursts while lower priorities still get a share of
+   * every sweep
+   * @return Handle to be used for unregistration
+   */
+  handle_t register_pollable(poll_fn_t poll, int priority = 0);
+
+  /**
+   * @brief Unregister a poll function
+   *
+   * Blocks until no worker is executing the poll function any more, then
+   * drains it on the calling thread until it reports no more work.
+   */
+  void unregister_pollable(handle_t handle);
+
+  // ONLY TO BE USED FOR TESTING!
+  static void reset() { s_instance.reset(nullptr); }
+
+  CallbackDispatcher(const CallbackDispatcher&) = delete;
+  CallbackDispatcher& operator=(const CallbackDispatcher&) = delete;
+  CallbackDispatcher(CallbackDispatcher&&) = delete;
+  CallbackDispatcher& operator=(CallbackDispatcher&&) = delete;
+
+private:
+  struct PollEntry
+  {
+    poll_fn_t m_poll;
+    int m_priority{ 0 };
+    std::atomic_flag m_busy = ATOMIC_FLAG_INIT;
+    std::atomic<bool> m_active{ true };
+  };
+
+  CallbackDispatcher() = default;
+
+  void start_workers();
+  void worker_loop();
+  static size_t num_workers();
+
+  std::map<handle_t, std::shared_ptr<PollEntry>> m_entries;
+  std::mutex m_entries_mutex;
+  handle_t m_next_handle{ 1 };
+
+  std::vector<std::thread> m_workers;
+  std::atomic<bool> m_running{ false };
+  std::mutex m_wakeup_mutex;
+  std::condition_variable m_wakeup;
+
+  static std::unique_ptr<CallbackDispatcher> s_instance;
+};
+
+} // namespace iomanager
+} // namespace dunedaq
+
+#endif // IOMANAGER_INCLUDE_IOMANAGER_CALLBACKDISPATCHER_HPP_
@@ -32,6 +32,18 @@ ERS_DECLARE_ISSUE(iomanager,
                   NetworkMessageNotSerializable,
                   "Object of type " << type << " is not serializable but configured for network transfer!",
                   ((std::string)type))
+
+ERS_DECLARE_ISSUE(iomanager,
+                  RawFormatUnavailable,
+                  "Connection " << conn_uid << " requests raw serialization but type " << type
+                                << " is not trivially copyable; falling back to msgpack",
+                  ((std::string)conn_uid)((std::string)type))
+
+ERS_DECLARE_ISSUE(iomanager,
+                  RawMessageSizeMismatch,
+                  "Raw message on connection " << conn_uid << " carries " << received << " byte(s) but type " << type
+                                               << " expects " << expected,
+                  ((std::string)conn_uid)((size_t)received)((std::string)type)((size_t)expected))
 // Re-enable coverage collection LCOV_EXCL_STOP
 
 } // namespace dunedaq
@@ -13,6 +13,7 @@
 
 #include <sstream>
 #include <string>
+#include <vector>
 
 namespace dunedaq {
 namespace iomanager {
@@ -38,6 +39,27 @@ operator<(const ConnectionRef& l, const ConnectionRef& r)
 // We are doing this here because we really, really want these structs to be in the iomanager namespace!
 using namespace connection; // NOLINT
 
+/**
+ * @brief Split a connection URI that may declare several comma-separated
+ * endpoints (a striped connection, see NetworkSenderModel) into its
+ * endpoint list. A plain URI yields a single endpoint.
+ */
+inline std::vector<std::string>
+endpoints_of_uri(const std::string& uri)
+{
+  std::vector<std::string> endpoints;
+  size_t start = 0;
+  while (true) {
+    auto comma = uri.find(',', start);
+    if (comma == std::string::npos) {
+      endpoints.push_back(uri.substr(start));
+      return endpoints;
+    }
+    endpoints.push_back(uri.substr(start, comma - start));
+    start = comma + 1;
+  }
+}
+
 } // namespace iomanager
 } // namespace dunedaq
 
@@ -0,0 +1,126 @@
+/**
+ * @file DirectQueue.hpp
+ *
+ * Compile-time bound queue handles. Where the queue kind for a connection
+ * is known at build time, DirectQueueSender/DirectQueueReceiver skip the
+ * SenderConcept/ReceiverConcept virtual dispatch and shared_ptr
+ * indirection of the regular models: the concrete queue type is named in
+ * the handle's template arguments and push/pop are invoked through
+ * class-qualified calls, so they devirtualize and inline into the caller.
+ *
+ * This is part of the DUNE DAQ Application Framework, copyright 2020.
+ * Licensing/copyright details are in the COPYING file that you should have
+ * received with this code.
+ */
+
+#ifndef IOMANAGER_INCLUDE_IOMANAGER_DIRECTQUEUE_HPP_
+#define IOMANAGER_INCLUDE_IOMANAGER_DIRECTQUEUE_HPP_
+
+#include "iomanager/CommonIssues.hpp"
+#include "iomanager/Queue.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace dunedaq {
+
+// Disable coverage collection LCOV_EXCL_START
+ERS_DECLARE_ISSUE(iomanager,
+                  DirectBindingMismatch,
+                  "Queue for connection " << conn_uid << " is not of the requested kind " << requested_kind,
+                  ((std::string)conn_uid)((std::string)requested_kind))
+// Re-enable coverage collection LCOV_EXCL_STOP
+
+namespace iomanager {
+
+/**
+ * @brief Sender handle bound to a concrete queue type at compile time.
+ *
+ * Obtained from IOManager::get_direct_sender. Note that sends through a
+ * direct handle bypass the per-connection counters of the Sender base
+ * class; this is the price of removing every indirection from the
+ * innermost loop.
+ */
+template<typename Datatype, template<typename> class QueueType>
+class DirectQueueSender
+{
+public:
+  using queue_t = QueueType<Datatype>;
+  using duration_t = typename queue_t::duration_t;
+
+  explicit DirectQueueSender(std::shared_ptr<queue_t> queue)
+    : m_queue(std::move(queue))
+    , m_queue_raw(m_queue.get())
+  {}
+
+  void send(Datatype&& data, duration_t timeout)
+  {
+    try {
+      // The class-qualified call suppresses virtual dispatch
+      m_queue_raw->queue_t::push(std::move(data), timeout);
+    } catch (QueueTimeoutExpired& ex) {
+      throw TimeoutExpired(ERS_HERE, m_queue_raw->get_name(), "push", timeout.count(), ex);
+    }
+  }
+
+  bool try_send(Datatype&& data, duration_t timeout)
+  {
+    return m_queue_raw->queue_t::try_push(std::move(data), timeout);
+  }
+
+  bool can_send() const { return m_queue_raw->queue_t::can_push(); }
+
+private:
+  std::shared_ptr<queue_t> m_queue; ///< Keeps the queue alive
+  queue_t* m_queue_raw;             ///< Used for the hot-path calls
+};
+
+/**
+ * @brief Receiver handle bound to a concrete queue type at compile time,
+ * see DirectQueueSender
+ */
+template<typename Datatype, template<typename> class QueueType>
+class DirectQueueReceiver
+{
+public:
+  using queue_t = QueueType<Datatype>;
+  using duration_t = typename queue_t::duration_t;
+
+  explicit DirectQueueReceiver(std::shared_ptr<queue_t> queue)
+    : m_queue(std::move(queue))
+    , m_queue_raw(m_queue.get())
+  {}
+
+  Datatype receive(duration_t timeout)
+  {
+    Datatype dt;
+    receive_into(dt, timeout);
+    return dt;
+  }
+
+  void receive_into(Datatype& dt, duration_t timeout)
+  {
+    try {
+      m_queue_raw->queue_t::pop(dt, timeout);
+    } catch (QueueTimeoutExpired& ex) {
+      throw TimeoutExpired(ERS_HERE, m_queue_raw->get_name(), "pop", timeout.count(), ex);
+    }
+  }
+
+  bool try_receive_into(Datatype& dt, duration_t timeout)
+  {
+    return m_queue_raw->queue_t::try_pop(dt, timeout);
+  }
+
+  bool can_receive() const { return m_queue_raw->queue_t::can_pop(); }
+
+private:
+  std::shared_ptr<queue_t> m_queue; ///< Keeps the queue alive
+  queue_t* m_queue_raw;             ///< Used for the hot-path calls
+};
+
+} // namespace iomanager
+} // namespace dunedaq
+
+#endif // IOMANAGER_INCLUDE_IOMANAGER_DIRECTQUEUE_HPP_
@@ -18,10 +18,12 @@
 #include "iomanager/Queue.hpp"
 
 #include "folly/concurrency/DynamicBoundedQueue.h"
+#include "folly/concurrency/UnboundedQueue.h"
 #include "logging/Logging.hpp"
 
 #include <string>
 #include <utility> // For std::move
+#include <vector>
 
 namespace dunedaq::iomanager {
 
@@ -46,16 +48,28 @@ public:
 
   void pop(value_t& val, const duration_t& dur) override
   {
+    // An infinite timeout parks directly on the queue's futex instead of
+    // going through the deadline machinery
+    if (dur == duration_t::max()) {
+      m_queue.dequeue(val);
+      this->note_pop();
+      return;
+    }
     if (!m_queue.try_dequeue_for(val, dur)) {
       throw QueueTimeoutExpired(
         ERS_HERE, this->get_name(), "pop", std::chrono::duration_cast<std::chrono::milliseconds>(dur).count());
     }
+    this->note_pop();
   }
   bool try_pop(value_t& val, const duration_t& dur) override
   {
     if (!m_queue.try_dequeue_for(val, dur)) {
+      if (dur.count() > 0) {
+        this->note_pop_timeout(std::chrono::duration_cast<std::chrono::milliseconds>(dur).count());
+      }
       return false;
     }
+    this->note_pop();
     return true;
   }
 
@@ -63,21 +77,61 @@ public:
 
   void push(value_t&& t, const duration_t& dur) override
   {
+    // See pop(): infinite timeouts block on the futex directly
+    if (dur == duration_t::max()) {
+      m_queue.enqueue(std::move(t));
+      this->note_push();
+      return;
+    }
     if (!m_queue.try_enqueue_for(std::move(t), dur)) {
       throw QueueTimeoutExpired(
         ERS_HERE, this->get_name(), "push", std::chrono::duration_cast<std::chrono::milliseconds>(dur).count());
     }
+    this->note_push();
   }
   bool try_push(value_t&& t, const duration_t& dur) override
   {
     if (!m_queue.try_enqueue_for(std::move(t), dur)) {
-      ers::error(QueueTimeoutExpired(
-        ERS_HERE, this->get_name(), "push", std::chrono::duration_cast<std::chrono::milliseconds>(dur).count()));
+      // Counter plus rate-limited report instead of one ERS issue per
+      // failed push, which would melt down under a stalled consumer
+      this->note_push_timeout(std::chrono::duration_cast<std::chrono::milliseconds>(dur).count());
       return false;
     }
+    this->note_push();
     return true;
   }
 
+  void push_bulk(std::vector<value_t>&& vals, const duration_t& dur) override
+  {
+    for (auto& val : vals) {
+      // Plain try_enqueue skips the deadline arithmetic of
+      // try_enqueue_for; only fall back to the waiting variant when the
+      // queue is full
+      if (!m_queue.try_enqueue(std::move(val)) && !m_queue.try_enqueue_for(std::move(val), dur)) {
+        throw QueueTimeoutExpired(
+          ERS_HERE, this->get_name(), "push", std::chrono::duration_cast<std::chrono::milliseconds>(dur).count());
+      }
+      this->note_push();
+    }
+  }
+
+  size_t pop_bulk(std::vector<value_t>& vals, size_t max_n, const duration_t& dur) override
+  {
+    vals.clear();
+    vals.reserve(max_n);
+    value_t val;
+    if (!m_queue.try_dequeue_for(val, dur)) {
+      return 0;
+    }
+    vals.emplace_back(std::move(val));
+    // Drain without re-arming the timeout for each element
+    while (vals.size() < max_n && m_queue.try_dequeue(val)) {
+      vals.emplace_back(std::move(val));
+    }
+    this->note_pop();
+    return vals.size();
+  }
+
   // Delete the copy and move operations
   FollyQueue(const FollyQueue&) = delete;
   FollyQueue& operator=(const FollyQueue&) = delete;
@@ -98,6 +152,109 @@ using FollySPSCQueue = FollyQueue<T, folly::DSPSCQueue>;
 template<typename T>
 using FollyMPMCQueue = FollyQueue<T, folly::DMPMCQueue>;
 
+template<typename T>
+using FollyMPSCQueue = FollyQueue<T, folly::DMPSCQueue>;
+
+/**
+ * Wrapper around folly::UMPMCQueue. Pushes never block and never time
+ * out; the configured capacity is only used as a watermark for can_push,
+ * so producers that must not stall (at the price of unbounded memory use)
+ * can use this kind.
+ */
+template<class T>
+class FollyUnboundedQueue : public Queue<T>
+{
+public:
+  using value_t = T;
+  using duration_t = typename Queue<T>::duration_t;
+
+  explicit FollyUnboundedQueue(const std::string& name, size_t capacity)
+    : Queue<T>(name)
+    , m_capacity(capacity)
+  {}
+
+  size_t get_capacity() const noexcept override { return m_capacity; }
+
+  size_t get_num_elements() const noexcept override { return m_queue.size(); }
+
+  bool can_pop() const noexcept override { return !m_queue.empty(); }
+
+  void pop(value_t& val, const duration_t& dur) override
+  {
+    if (dur == duration_t::max()) {
+      m_queue.dequeue(val);
+      this->note_pop();
+      return;
+    }
+    if (!m_queue.try_dequeue_for(val, dur)) {
+      throw QueueTimeoutExpired(
+        ERS_HERE, this->get_name(), "pop", std::chrono::duration_cast<std::chrono::milliseconds>(dur).count());
+    }
+    this->note_pop();
+  }
+  bool try_pop(value_t& val, const duration_t& dur) override
+  {
+    if (!m_queue.try_dequeue_for(val, dur)) {
+      if (dur.count() > 0) {
+        this->note_pop_timeout(std::chrono::duration_cast<std::chrono::milliseconds>(dur).count());
+      }
+      return false;
+    }
+    this->note_pop();
+    return true;
+  }
+
+  size_t pop_bulk(std::vector<value_t>& vals, size_t max_n, const duration_t& dur) override
+  {
+    vals.clear();
+    vals.reserve(max_n);
+    value_t val;
+    if (!m_queue.try_dequeue_for(val, dur)) {
+      return 0;
+    }
+    vals.emplace_back(std::move(val));
+    while (vals.size() < max_n && m_queue.try_dequeue(val)) {
+      vals.emplace_back(std::move(val));
+    }
+    this->note_pop();
+    return vals.size();
+  }
+
+  bool can_push() const noexcept override { return m_queue.size() < m_capacity; }
+
+  void push(value_t&& t, const duration_t&) override
+  {
+    m_queue.enqueue(std::move(t));
+    this->note_push();
+  }
+  bool try_push(value_t&& t, const duration_t&) override
+  {
+    m_queue.enqueue(std::move(t));
+    this->note_push();
+    return true;
+  }
+
+  void push_bulk(std::vector<value_t>&& vals, const duration_t&) override
+  {
+    for (auto& val : vals) {
+      m_queue.enqueue(std::move(val));
+    }
+    this->note_push();
+  }
+
+  // Delete the copy and move operations
+  FollyUnboundedQueue(const FollyUnboundedQueue&) = delete;
+  FollyUnboundedQueue& operator=(const FollyUnboundedQueue&) = delete;
+  FollyUnboundedQueue(FollyUnboundedQueue&&) = delete;
+  FollyUnboundedQueue& operator=(FollyUnboundedQueue&&) = delete;
+
+private:
+  // As in FollyQueue, `MayBlock` set to true means consumers make a
+  // system call to wait instead of spinning
+  folly::UMPMCQueue<T, true> m_queue;
+  size_t m_capacity;
+};
+
 } // namespace dunedaq::iomanager
 
 #endif // IOMANAGER_INCLUDE_IOMANAGER_FOLLYQUEUE_HPP_
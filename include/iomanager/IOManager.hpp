@@ -10,6 +10,7 @@
 #define IOMANAGER_INCLUDE_IOMANAGER_IOMANAGER_HPP_
 
 #include "iomanager/ConnectionId.hpp"
+#include "iomanager/DirectQueue.hpp"
 #include "iomanager/QueueRegistry.hpp"
 #include "iomanager/Receiver.hpp"
 #include "iomanager/Sender.hpp"
@@ -18,12 +19,23 @@
 
 #include "nlohmann/json.hpp"
 
+#include <atomic>
+#include <chrono>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <regex>
+#include <shared_mutex>
 #include <string>
+#include <thread>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
 #include <cstdlib>
 
+#include <unistd.h>
+
 namespace dunedaq {
 // Disable coverage collection LCOV_EXCL_START
 ERS_DECLARE_ISSUE(iomanager,
@@ -35,6 +47,10 @@ ERS_DECLARE_ISSUE(iomanager,
                   "Connection reference with name " << name << " specified direction " << direction
                                                     << ", but tried to obtain a " << handle_type,
                   ((std::string)name)((std::string)direction)((std::string)handle_type))
+ERS_DECLARE_ISSUE(iomanager,
+                  SourceResolutionFailed,
+                  "Failed to resolve source URI " << uri << ": " << reason,
+                  ((std::string)uri)((std::string)reason))
 // Re-enable coverage collection LCOV_EXCL_STOP
 
 namespace iomanager {
@@ -65,9 +81,12 @@ public:
   {
     std::cout << "configure(connections) called\n";
     m_connections = connections;
+    build_connection_index();
     std::map<std::string, QueueConfig> qCfg;
     dunedaq::networkmanager::nwmgr::Connections nwCfg;
-    std::regex queue_uri_regex("queue://(\\w+):(\\d+)");
+    // An optional trailing @N places the queue storage on NUMA node N,
+    // e.g. queue://FollySPSCQueue:10000@1
+    std::regex queue_uri_regex("queue://(\\w+):(\\d+)(?:@(\\d+))?");
 
     for (auto& connection : m_connections) {
       if (connection.service_type == ServiceType::kQueue) {
@@ -75,6 +94,9 @@ public:
         std::regex_match(connection.uri, sm, queue_uri_regex);
         qCfg[connection.uid].kind = QueueConfig::stoqk(sm[1]);
         qCfg[connection.uid].capacity = stoi(sm[2]);
+        if (sm[3].matched) {
+          qCfg[connection.uid].numa_node = stoi(sm[3]);
+        }
       } else {
 
         // here if connection is a host or a source name. If
@@ -86,16 +108,29 @@ public:
 
         if (connection.service_type == ServiceType::kNetSender ||
                  connection.service_type == ServiceType::kNetReceiver) {
+          // A comma-separated uri declares a striped connection: one
+          // networkmanager connection (and socket) per endpoint, which
+          // the sender/receiver models stripe across
+          auto endpoints = endpoints_of_uri(connection.uri);
+          if (endpoints.size() > 1) {
+            for (size_t idx = 0; idx < endpoints.size(); ++idx) {
+              dunedaq::networkmanager::nwmgr::Connection stripe_conn;
+              stripe_conn.name = connection.uid + "#" + std::to_string(idx);
+              stripe_conn.address = maybe_use_ipc_uri(endpoints[idx]);
+              nwCfg.push_back(stripe_conn);
+            }
+            continue;
+          }
           dunedaq::networkmanager::nwmgr::Connection this_conn;
           this_conn.name = connection.uid;
-          this_conn.address = connection.uri;
+          this_conn.address = maybe_use_ipc_uri(connection.uri);
           nwCfg.push_back(this_conn);
         } else if (connection.service_type == ServiceType::kPublisher ||
                  connection.service_type == ServiceType::kSubscriber) {
           dunedaq::networkmanager::nwmgr::Connection this_conn;
           this_conn.topics = connection.topics;
           this_conn.name = connection.uid;
-          this_conn.address = connection.uri;
+          this_conn.address = maybe_use_ipc_uri(connection.uri);
           nwCfg.push_back(this_conn);
         } else {
           // throw ers issue?
@@ -110,10 +145,17 @@ public:
   void reset()
   {
     m_connections.clear();
+    m_connection_index.clear();
+    m_topic_index.clear();
+    m_intern_index.clear();
+    m_intern_uids.clear();
     QueueRegistry::get().reset();
-    networkmanager::NetworkManager::get().reset();
     m_senders.clear();
     m_receivers.clear();
+    // Demux readers must stop before the sockets they read from go away
+    TopicDemux::reset();
+    networkmanager::NetworkManager::get().reset();
+    ++s_config_epoch; // invalidate the per-datatype handle caches
     s_instance = nullptr;
   }
 
@@ -131,16 +173,37 @@ public:
       throw ConnectionDirectionMismatch(ERS_HERE, conn_ref.name, "input", "sender");
     }
 
+    // Fast path: repeat lookups for this Datatype hit a read-mostly cache
+    // of already-cast handles under a shared lock, skipping the creation
+    // mutex, the ordered-map walk and the dynamic_pointer_cast below
+    static HandleCache<SenderConcept<Datatype>> dt_sender_cache;
+    {
+      std::shared_lock<std::shared_mutex> lk(dt_sender_cache.mutex);
+      if (dt_sender_cache.epoch == s_config_epoch.load()) {
+        auto it = dt_sender_cache.handles.find(conn_ref.uid);
+        if (it != dt_sender_cache.handles.end()) {
+          return it->second;
+        }
+      }
+    }
+
+    std::unique_lock<std::shared_mutex> cache_lk(dt_sender_cache.mutex);
+    if (dt_sender_cache.epoch != s_config_epoch.load()) {
+      dt_sender_cache.handles.clear();
+      dt_sender_cache.epoch = s_config_epoch.load();
+    }
+
     static std::mutex dt_sender_mutex;
     std::lock_guard<std::mutex> lk(dt_sender_mutex);
 
-    if (!m_senders.count(conn_ref)) {
+    auto slot = intern_id(conn_ref.uid);
+    if (m_senders[slot] == nullptr) {
       // create from lookup service's factory function
       // based on connID we know if it's queue or network
       auto conn_id = ref_to_id(conn_ref);
       if (conn_id.service_type == ServiceType::kQueue) { // if queue
         TLOG() << "Creating QueueSenderModel for service_name " << conn_id.uid;
-        m_senders[conn_ref] =
+        m_senders[slot] =
           std::make_shared<QueueSenderModel<Datatype>>(QueueSenderModel<Datatype>(conn_id, conn_ref));
       } else if (conn_id.service_type == ServiceType::kNetSender || conn_id.service_type == ServiceType::kPublisher) {
         TLOG() << "Creating NetworkSenderModel for service_name " << conn_id.uid;
@@ -150,28 +213,8 @@ public:
         // it's a source. look up the host in the config server and
         // update conn_id.uri
         if (conn_id.uri.substr(0,4) == "src:") {
-          std::string connectionServer="configdict.connections";
-          char* env=getenv("CONNECTION_SERVER");
-          if (env) {
-            connectionServer=std::string(env);
-          }
-          std::string connectionPort="5000";
-          env=getenv("CONNECTION_PORT");
-          if (env) {
-            connectionPort=std::string(env);
-          }
-          configclient::ConfigClient cc(connectionServer, connectionPort);
-          int gstart=4;
-          if (conn_id.uri.substr(gstart,2) == "//") {
-            gstart+=2;
-          }
-          std::string app=cc.getSourceApp(conn_id.uri.substr(gstart));
-          std::string conf=cc.getAppConfig(app);
-          auto jsconf=nlohmann::json::parse(conf);
-          std::string host=jsconf["host"];
-          std::string port=jsconf["port"];
           std::cout << "Replacing conn_id.uri <" << conn_id.uri << ">";
-          conn_id.uri="tcp://"+host+":"+port;
+          conn_id.uri = resolve_source_uri(conn_id.uri);
           std::cout << " with <" << conn_id.uri << ">" << std::endl;
           dunedaq::networkmanager::nwmgr::Connections nwCfg;
           dunedaq::networkmanager::nwmgr::Connection this_conn;
@@ -182,14 +225,16 @@ public:
         }
 
 
-        m_senders[conn_ref] =
+        m_senders[slot] =
           std::make_shared<NetworkSenderModel<Datatype>>(
             NetworkSenderModel<Datatype>(conn_id, conn_ref));
       } else {
         throw ConnectionDirectionMismatch(ERS_HERE, conn_ref.name, "output", connection::str(conn_id.service_type));
       }
     }
-    return std::dynamic_pointer_cast<SenderConcept<Datatype>>(m_senders[conn_ref]);
+    auto sender = std::dynamic_pointer_cast<SenderConcept<Datatype>>(m_senders[slot]);
+    dt_sender_cache.handles[conn_ref.uid] = sender;
+    return sender;
   }
 
   template<typename Datatype>
@@ -206,29 +251,173 @@ public:
       throw ConnectionDirectionMismatch(ERS_HERE, conn_ref.name, "output", "receiver");
     }
 
+    // Fast path, see get_sender
+    static HandleCache<ReceiverConcept<Datatype>> dt_receiver_cache;
+    {
+      std::shared_lock<std::shared_mutex> lk(dt_receiver_cache.mutex);
+      if (dt_receiver_cache.epoch == s_config_epoch.load()) {
+        auto it = dt_receiver_cache.handles.find(conn_ref.uid);
+        if (it != dt_receiver_cache.handles.end()) {
+          return it->second;
+        }
+      }
+    }
+
+    std::unique_lock<std::shared_mutex> cache_lk(dt_receiver_cache.mutex);
+    if (dt_receiver_cache.epoch != s_config_epoch.load()) {
+      dt_receiver_cache.handles.clear();
+      dt_receiver_cache.epoch = s_config_epoch.load();
+    }
+
     static std::mutex dt_receiver_mutex;
     std::lock_guard<std::mutex> lk(dt_receiver_mutex);
 
-    if (!m_receivers.count(conn_ref)) {
+    auto slot = intern_id(conn_ref.uid);
+    if (m_receivers[slot] == nullptr) {
       auto conn_id = ref_to_id(conn_ref);
       if (conn_id.service_type == ServiceType::kQueue) { // if queue
         TLOG() << "Creating QueueReceiverModel for service_name " << conn_id.uid;
-        m_receivers[conn_ref] =
+        m_receivers[slot] =
           std::make_shared<QueueReceiverModel<Datatype>>(QueueReceiverModel<Datatype>(conn_id, conn_ref));
       } else if (conn_id.service_type == ServiceType::kNetReceiver) {
         TLOG() << "Creating NetworkReceiverModel for service_name " << conn_id.uid;
-        m_receivers[conn_ref] =
+        m_receivers[slot] =
           std::make_shared<NetworkReceiverModel<Datatype>>(NetworkReceiverModel<Datatype>(conn_id, conn_ref));
       } else if (conn_id.service_type == ServiceType::kSubscriber) {
         TLOG() << "Creating NetworkReceiverModel for service_name " << conn_ref.uid;
         // This ConnectionRef refers to a topic if its uid is not the same as the returned ConnectionId's uid
-        m_receivers[conn_ref] = std::make_shared<NetworkReceiverModel<Datatype>>(
+        m_receivers[slot] = std::make_shared<NetworkReceiverModel<Datatype>>(
           NetworkReceiverModel<Datatype>(conn_id, conn_ref, conn_id.uid != conn_ref.uid));
       } else {
         throw ConnectionDirectionMismatch(ERS_HERE, conn_ref.name, "input", connection::str(conn_id.service_type));
       }
     }
-    return std::dynamic_pointer_cast<ReceiverConcept<Datatype>>(m_receivers[conn_ref]); // NOLINT
+    auto receiver = std::dynamic_pointer_cast<ReceiverConcept<Datatype>>(m_receivers[slot]); // NOLINT
+    dt_receiver_cache.handles[conn_ref.uid] = receiver;
+    return receiver;
+  }
+
+  /**
+   * Get a sender handle bound to the concrete queue type at compile time,
+   * e.g. get_direct_sender<Fragment, FollySPSCQueue>("frag_queue").
+   * push/pop devirtualize and inline into the caller, skipping the
+   * SenderConcept virtual hop. Throws DirectBindingMismatch if the
+   * configured queue is not of the requested kind, so a config change
+   * cannot silently bind the wrong implementation.
+   */
+  template<typename Datatype, template<typename> class QueueType>
+  DirectQueueSender<Datatype, QueueType> get_direct_sender(std::string const& connection_uid)
+  {
+    return DirectQueueSender<Datatype, QueueType>(get_direct_queue<Datatype, QueueType>(connection_uid));
+  }
+
+  /// Compile-time bound receiver handle, see get_direct_sender
+  template<typename Datatype, template<typename> class QueueType>
+  DirectQueueReceiver<Datatype, QueueType> get_direct_receiver(std::string const& connection_uid)
+  {
+    return DirectQueueReceiver<Datatype, QueueType>(get_direct_queue<Datatype, QueueType>(connection_uid));
+  }
+
+  /**
+   * Resolve every src: connection up front instead of paying one serial
+   * config-server lookup per connection on first get_sender. Lookups run
+   * on a bounded pool of parallel workers and the resolved endpoints are
+   * registered with NetworkManager in a single configure call. Call after
+   * configure(); subsequent get_sender calls find the resolved URIs
+   * already in place. Connections that fail to resolve are reported and
+   * left as src: URIs so the lazy path can retry them.
+   */
+  void preconnect(size_t max_parallel = 16)
+  {
+    std::vector<size_t> pending;
+    for (size_t idx = 0; idx < m_connections.size(); ++idx) {
+      if (m_connections[idx].uri.substr(0, 4) == "src:") {
+        pending.push_back(idx);
+      }
+    }
+    if (pending.empty()) {
+      return;
+    }
+
+    dunedaq::networkmanager::nwmgr::Connections nwCfg;
+    std::mutex results_mutex;
+    std::atomic<size_t> next{ 0 };
+
+    auto num_workers = std::min(max_parallel, pending.size());
+    std::vector<std::thread> workers;
+    for (size_t w = 0; w < num_workers; ++w) {
+      workers.emplace_back([&]() {
+        std::unique_ptr<configclient::ConfigClient> cc;
+        while (true) {
+          auto idx = next.fetch_add(1);
+          if (idx >= pending.size()) {
+            return;
+          }
+          auto& conn = m_connections[pending[idx]];
+          try {
+            // Workers use their own client so cache misses really do
+            // resolve in parallel; results land in the shared cache
+            auto resolved = lookup_source_cache(conn.uri);
+            if (resolved.empty()) {
+              if (!cc) {
+                cc = make_config_client();
+              }
+              resolved = resolve_with_client(*cc, conn.uri);
+              store_source_cache(conn.uri, resolved);
+            }
+            std::lock_guard<std::mutex> lk(results_mutex);
+            conn.uri = resolved;
+            dunedaq::networkmanager::nwmgr::Connection this_conn;
+            this_conn.name = conn.uid;
+            this_conn.address = resolved;
+            nwCfg.push_back(this_conn);
+          } catch (std::exception const& ex) {
+            ers::error(SourceResolutionFailed(ERS_HERE, conn.uri, ex.what()));
+          }
+        }
+      });
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+
+    build_connection_index(); // pick up the resolved URIs
+    if (!nwCfg.empty()) {
+      networkmanager::NetworkManager::get().configure(nwCfg);
+    }
+  }
+
+  /**
+   * Drop all cached src: resolutions, forcing the next lookups back to
+   * the config server (e.g. after endpoints have moved). The cache
+   * otherwise deliberately survives reset() so run restarts don't hammer
+   * the config server.
+   */
+  static void invalidate_source_cache()
+  {
+    std::lock_guard<std::mutex> lk(s_source_cache_mutex);
+    s_source_cache.clear();
+  }
+
+  // Gather per-connection statistics from senders and receivers
+  void gather_stats(opmonlib::InfoCollector& ic, int level)
+  {
+    for (size_t slot = 0; slot < m_senders.size(); ++slot) {
+      if (m_senders[slot] == nullptr) {
+        continue;
+      }
+      opmonlib::InfoCollector tmp_ic;
+      m_senders[slot]->get_info(tmp_ic, level);
+      ic.add(m_intern_uids[slot], tmp_ic);
+    }
+    for (size_t slot = 0; slot < m_receivers.size(); ++slot) {
+      if (m_receivers[slot] == nullptr) {
+        continue;
+      }
+      opmonlib::InfoCollector tmp_ic;
+      m_receivers[slot]->get_info(tmp_ic, level);
+      ic.add(m_intern_uids[slot], tmp_ic);
+    }
   }
 
   template<typename Datatype>
@@ -247,21 +436,15 @@ public:
 
   const ConnectionId ref_to_id(ConnectionRef const& ref) const
   {
-    for (auto& conn : m_connections) {
-      if (conn.uid == ref.uid)
-        return conn;
-    }
+    auto conn_it = m_connection_index.find(ref.uid);
+    if (conn_it != m_connection_index.end())
+      return conn_it->second;
 
     // Subscribers can have a UID that is a topic they are interested in. Return the first matching conn ID
     if (ref.dir == Direction::kInput) {
-      for (auto& conn : m_connections) {
-        if (conn.service_type == ServiceType::kSubscriber) {
-          for (auto& topic : conn.topics) {
-            if (topic == ref.uid)
-              return conn;
-          }
-        }
-      }
+      auto topic_it = m_topic_index.find(ref.uid);
+      if (topic_it != m_topic_index.end())
+        return topic_it->second;
     }
 
     throw ConnectionNotFound(ERS_HERE, ref.uid);
@@ -270,13 +453,238 @@ public:
 private:
   IOManager() {}
 
-  using SenderMap = std::map<ConnectionRef, std::shared_ptr<Sender>>;
-  using ReceiverMap = std::map<ConnectionRef, std::shared_ptr<Receiver>>;
+  /**
+   * Per-Datatype cache of already-cast handles, one instance per template
+   * instantiation of get_sender/get_receiver. Repeat lookups only take a
+   * shared lock and do a single hash lookup. The cache is invalidated via
+   * s_config_epoch when the IOManager is reset.
+   */
+  template<typename ConceptType>
+  struct HandleCache
+  {
+    std::shared_mutex mutex;
+    std::unordered_map<std::string, std::shared_ptr<ConceptType>> handles;
+    uint64_t epoch{ 0 };
+  };
+
+  /**
+   * Rewrite a tcp:// URI whose endpoint lives on this host to a ZeroMQ
+   * ipc:// endpoint, so that same-host connections go through a unix
+   * domain socket (in-kernel memory copy) instead of the full TCP stack.
+   * The endpoint file is derived from the port, which uniquely identifies
+   * the listener on the host. Only active when IOMANAGER_SAMEHOST_IPC is
+   * set, since all processes sharing a connection must agree on the
+   * rewrite.
+   */
+  std::string maybe_use_ipc_uri(std::string const& uri) const
+  {
+    if (getenv("IOMANAGER_SAMEHOST_IPC") == nullptr) {
+      return uri;
+    }
+
+    static std::regex tcp_uri_regex("tcp://([^:]+):(\\d+)");
+    std::smatch sm;
+    if (!std::regex_match(uri, sm, tcp_uri_regex)) {
+      return uri;
+    }
+
+    std::string host = sm[1];
+    if (host != "localhost" && host != "127.0.0.1" && host != "0.0.0.0" && host != "*") {
+      char hostname[256];
+      if (gethostname(hostname, sizeof(hostname)) != 0 || host != hostname) {
+        return uri;
+      }
+    }
+
+    return "ipc:///tmp/iomanager_" + std::string(sm[2]) + ".ipc";
+  }
+
+  /// Resolve a connection to its concrete queue instance for the direct
+  /// handles above
+  template<typename Datatype, template<typename> class QueueType>
+  std::shared_ptr<QueueType<Datatype>> get_direct_queue(std::string const& connection_uid)
+  {
+    ConnectionRef dummy_ref{ connection_uid, connection_uid, Direction::kUnspecified };
+    auto conn_id = ref_to_id(dummy_ref);
+    if (conn_id.service_type != ServiceType::kQueue) {
+      throw ConnectionDirectionMismatch(ERS_HERE, connection_uid, "queue", connection::str(conn_id.service_type));
+    }
+    auto queue = QueueRegistry::get().get_queue<Datatype>(conn_id.uid);
+    auto typed = std::dynamic_pointer_cast<QueueType<Datatype>>(queue);
+    if (!typed) {
+      throw DirectBindingMismatch(ERS_HERE, conn_id.uid, typeid(QueueType<Datatype>).name());
+    }
+    return typed;
+  }
+
+  /**
+   * Look up a src: URI and return the concrete endpoint URI it maps to
+   * (after the same-host ipc rewrite). Resolutions are served from a
+   * static TTL cache where possible, so re-acquiring senders after
+   * reset() during a run restart does not go back to the config server;
+   * cache misses go through a single long-lived ConfigClient instead of
+   * building one per lookup.
+   */
+  std::string resolve_source_uri(std::string const& uri) const
+  {
+    auto resolved = lookup_source_cache(uri);
+    if (!resolved.empty()) {
+      return resolved;
+    }
+
+    std::lock_guard<std::mutex> lk(s_config_client_mutex);
+    if (!s_config_client) {
+      s_config_client = make_config_client();
+    }
+    resolved = resolve_with_client(*s_config_client, uri);
+    store_source_cache(uri, resolved);
+    return resolved;
+  }
+
+  /// Build a ConfigClient from the CONNECTION_SERVER/CONNECTION_PORT
+  /// environment (with the historical defaults)
+  static std::unique_ptr<configclient::ConfigClient> make_config_client()
+  {
+    std::string connectionServer = "configdict.connections";
+    char* env = getenv("CONNECTION_SERVER");
+    if (env) {
+      connectionServer = std::string(env);
+    }
+    std::string connectionPort = "5000";
+    env = getenv("CONNECTION_PORT");
+    if (env) {
+      connectionPort = std::string(env);
+    }
+    return std::make_unique<configclient::ConfigClient>(connectionServer, connectionPort);
+  }
+
+  /// The two config-server round-trips plus JSON parse for one src: URI
+  std::string resolve_with_client(configclient::ConfigClient& cc, std::string const& uri) const
+  {
+    size_t gstart = 4;
+    if (uri.substr(gstart, 2) == "//") {
+      gstart += 2;
+    }
+    std::string app = cc.getSourceApp(uri.substr(gstart));
+    std::string conf = cc.getAppConfig(app);
+    auto jsconf = nlohmann::json::parse(conf);
+    std::string host = jsconf["host"];
+    std::string port = jsconf["port"];
+    return maybe_use_ipc_uri("tcp://" + host + ":" + port);
+  }
+
+  /**
+   * How long a cached source resolution stays valid, from
+   * IOMANAGER_SOURCE_CACHE_TTL_MS. Defaults to one minute; 0 means
+   * entries never expire (use invalidate_source_cache() when endpoints
+   * move).
+   */
+  static std::chrono::milliseconds source_cache_ttl()
+  {
+    char* env = getenv("IOMANAGER_SOURCE_CACHE_TTL_MS"); // NOLINT(concurrency-mt-unsafe)
+    if (env == nullptr) {
+      return std::chrono::milliseconds(60000);
+    }
+    return std::chrono::milliseconds(strtoul(env, nullptr, 0)); // NOLINT(runtime/threadsafe_fn)
+  }
+
+  /// Cached resolution for uri, or "" on miss/expiry
+  static std::string lookup_source_cache(std::string const& uri)
+  {
+    auto ttl = source_cache_ttl();
+    std::lock_guard<std::mutex> lk(s_source_cache_mutex);
+    auto it = s_source_cache.find(uri);
+    if (it == s_source_cache.end()) {
+      return "";
+    }
+    if (ttl.count() > 0 && std::chrono::steady_clock::now() - it->second.resolved_at >= ttl) {
+      s_source_cache.erase(it);
+      return "";
+    }
+    return it->second.uri;
+  }
+
+  static void store_source_cache(std::string const& uri, std::string const& resolved)
+  {
+    std::lock_guard<std::mutex> lk(s_source_cache_mutex);
+    s_source_cache[uri] = { resolved, std::chrono::steady_clock::now() };
+  }
+
+  /**
+   * Build hash indexes from connection uid and subscriber topic to
+   * ConnectionId, so that ref_to_id is O(1) instead of a linear scan over
+   * all connections (and their topic lists) per lookup
+   */
+  void build_connection_index()
+  {
+    m_connection_index.clear();
+    m_topic_index.clear();
+    m_intern_index.clear();
+    m_intern_uids.clear();
+    for (auto& conn : m_connections) {
+      m_connection_index.emplace(conn.uid, conn);
+      intern_uid(conn.uid);
+      if (conn.service_type == ServiceType::kSubscriber) {
+        for (auto& topic : conn.topics) {
+          // emplace keeps the first matching connection for each topic
+          m_topic_index.emplace(topic, conn);
+          intern_uid(topic);
+        }
+      }
+    }
+    // Handles live in flat arrays indexed by intern id. resize() (rather
+    // than a fresh array) keeps existing handles valid when preconnect()
+    // rebuilds the index, since the ids are stable for a given
+    // connection list.
+    m_senders.resize(m_intern_uids.size());
+    m_receivers.resize(m_intern_uids.size());
+  }
+
+  /// Assign uid the next dense intern id unless it already has one
+  void intern_uid(std::string const& uid)
+  {
+    if (m_intern_index.emplace(uid, m_intern_uids.size()).second) {
+      m_intern_uids.push_back(uid);
+    }
+  }
+
+  /**
+   * Dense id assigned to a connection uid (or subscriber topic) at
+   * configure() time. Handle lookups turn into one hash probe plus an
+   * array index instead of an ordered-map walk over ConnectionRef keys
+   * doing string compares at every node.
+   */
+  uint32_t intern_id(std::string const& uid) const
+  {
+    auto it = m_intern_index.find(uid);
+    if (it == m_intern_index.end()) {
+      throw ConnectionNotFound(ERS_HERE, uid);
+    }
+    return it->second;
+  }
+
   ConnectionIds_t m_connections;
-  SenderMap m_senders;
-  ReceiverMap m_receivers;
+  std::unordered_map<std::string, ConnectionId> m_connection_index;
+  std::unordered_map<std::string, ConnectionId> m_topic_index;
+  std::unordered_map<std::string, uint32_t> m_intern_index;
+  std::vector<std::string> m_intern_uids; ///< Reverse of m_intern_index
+  std::vector<std::shared_ptr<Sender>> m_senders;     ///< Indexed by intern id
+  std::vector<std::shared_ptr<Receiver>> m_receivers; ///< Indexed by intern id
+
+  struct SourceCacheEntry
+  {
+    std::string uri;
+    std::chrono::steady_clock::time_point resolved_at;
+  };
 
   static std::shared_ptr<IOManager> s_instance;
+  static std::atomic<uint64_t> s_config_epoch; ///< Bumped on reset(); starts at 1 so fresh caches never match stale entries
+
+  // src: resolution state; static so it outlives reset()
+  static std::unique_ptr<configclient::ConfigClient> s_config_client;
+  static std::mutex s_config_client_mutex;
+  static std::unordered_map<std::string, SourceCacheEntry> s_source_cache;
+  static std::mutex s_source_cache_mutex;
 };
 
 } // namespace iomanager
@@ -0,0 +1,124 @@
+/**
+ * @file InlineObject.hpp
+ *
+ * InlineObject is a unique_ptr-like handle that stores small payloads
+ * inline instead of on the heap. Queue<T> already keeps its elements in
+ * the ring slots, so a Queue<InlineObject<Fragment>> hands the payload
+ * itself from producer to consumer through queue memory: no allocation
+ * on push, no free on pop, and no pointer chase when the consumer reads
+ * it. Payloads too large for the inline buffer transparently fall back
+ * to heap storage, so the same Datatype works across a mix of sizes.
+ *
+ * This is part of the DUNE DAQ Application Framework, copyright 2020.
+ * Licensing/copyright details are in the COPYING file that you should have
+ * received with this code.
+ */
+
+#ifndef IOMANAGER_INCLUDE_IOMANAGER_INLINEOBJECT_HPP_
+#define IOMANAGER_INCLUDE_IOMANAGER_INLINEOBJECT_HPP_
+
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace dunedaq {
+namespace iomanager {
+
+/**
+ * @brief Move-only owning handle with the API of a unique_ptr, holding
+ * objects of up to MaxInline bytes inline
+ *
+ * Drop-in replacement for std::unique_ptr<T> as a queue Datatype: it is
+ * default-constructible (empty, like a null pointer), move-only, and
+ * dereferences to T. Moving an InlineObject moves the contained T and
+ * leaves the source empty, matching pointer semantics.
+ */
+template<typename T, size_t MaxInline = 256>
+class InlineObject
+{
+public:
+  /// Whether T is held in the handle itself rather than on the heap
+  static constexpr bool s_stores_inline = sizeof(T) <= MaxInline;
+
+  InlineObject() = default;
+  explicit InlineObject(T&& obj) { emplace(std::move(obj)); }
+
+  InlineObject(InlineObject&& other)
+    : m_storage(std::move(other.m_storage))
+  {
+    // A moved-from optional still holds a (moved-from) T; clear it so
+    // moved-from handles read as empty in both storage modes
+    other.reset();
+  }
+
+  InlineObject& operator=(InlineObject&& other)
+  {
+    if (this != &other) {
+      m_storage = std::move(other.m_storage);
+      other.reset();
+    }
+    return *this;
+  }
+
+  InlineObject(const InlineObject&) = delete;
+  InlineObject& operator=(const InlineObject&) = delete;
+
+  /// Construct the payload in place, destroying any current one
+  template<typename... Args>
+  T& emplace(Args&&... args)
+  {
+    if constexpr (s_stores_inline) {
+      return m_storage.emplace(std::forward<Args>(args)...);
+    } else {
+      m_storage = std::make_unique<T>(std::forward<Args>(args)...);
+      return *m_storage;
+    }
+  }
+
+  /// Destroy the payload, leaving the handle empty
+  void reset() { m_storage.reset(); }
+
+  explicit operator bool() const
+  {
+    if constexpr (s_stores_inline) {
+      return m_storage.has_value();
+    } else {
+      return m_storage != nullptr;
+    }
+  }
+
+  T* get()
+  {
+    if constexpr (s_stores_inline) {
+      return m_storage.has_value() ? &*m_storage : nullptr;
+    } else {
+      return m_storage.get();
+    }
+  }
+  const T* get() const { return const_cast<InlineObject*>(this)->get(); }
+
+  T& operator*() { return *get(); }
+  const T& operator*() const { return *get(); }
+  T* operator->() { return get(); }
+  const T* operator->() const { return get(); }
+
+private:
+  using storage_t = std::conditional_t<s_stores_inline, std::optional<T>, std::unique_ptr<T>>;
+  storage_t m_storage;
+};
+
+/// make_unique-style factory: make_inline_object<Fragment>(args...)
+template<typename T, size_t MaxInline = 256, typename... Args>
+InlineObject<T, MaxInline>
+make_inline_object(Args&&... args)
+{
+  InlineObject<T, MaxInline> obj;
+  obj.emplace(std::forward<Args>(args)...);
+  return obj;
+}
+
+} // namespace iomanager
+} // namespace dunedaq
+
+#endif // IOMANAGER_INCLUDE_IOMANAGER_INLINEOBJECT_HPP_
@@ -0,0 +1,250 @@
+/**
+ * @file MessageFraming.hpp
+ *
+ * Helpers for the wire framing that NetworkSenderModel and
+ * NetworkReceiverModel layer on top of plain serialized messages, e.g.
+ * the coalesced aggregate frames used for high-rate small messages.
+ *
+ * This is part of the DUNE DAQ Application Framework, copyright 2020.
+ * Licensing/copyright details are in the COPYING file that you should have
+ * received with this code.
+ */
+
+#ifndef IOMANAGER_INCLUDE_IOMANAGER_MESSAGEFRAMING_HPP_
+#define IOMANAGER_INCLUDE_IOMANAGER_MESSAGEFRAMING_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace dunedaq {
+namespace iomanager {
+namespace framing {
+
+// 0xC1 is the one byte value the msgpack spec reserves as "never used",
+// so a framed message can always be told apart from a plain serialized
+// message by its first byte. The second byte identifies the frame type.
+constexpr unsigned char s_frame_marker = 0xC1;
+constexpr char s_coalesce_tag = 'C';
+constexpr char s_chunk_tag = 'S';
+constexpr char s_topic_tag = 'T';
+constexpr char s_raw_tag = 'R';
+
+// marker, tag, two reserved bytes, u32 message count
+constexpr size_t s_coalesce_header_size = 8;
+
+// marker, tag, flags, reserved byte, u32 transfer id, u32 chunk index;
+// the payload runs to the end of the buffer
+constexpr size_t s_chunk_header_size = 12;
+constexpr char s_chunk_flag_last = 0x01;
+
+// marker, tag, u16 topic length; the topic string and then the payload
+// follow
+constexpr size_t s_topic_header_size = 4;
+
+// marker, tag, two reserved bytes; the object bytes run to the end of
+// the buffer
+constexpr size_t s_raw_header_size = 4;
+
+/**
+ * @brief Whether a received buffer is a coalesced aggregate frame (as
+ * opposed to a single plain serialized message)
+ */
+template<typename BufferType>
+bool
+is_coalesced_frame(BufferType const& data)
+{
+  return data.size() >= s_coalesce_header_size && static_cast<unsigned char>(data[0]) == s_frame_marker &&
+         data[1] == s_coalesce_tag;
+}
+
+/**
+ * @brief Reset buffer to an empty aggregate frame (header only). The
+ * message count is left zero and patched by patch_coalesced_count before
+ * the frame is sent.
+ */
+inline void
+start_coalesced_frame(std::vector<char>& buffer)
+{
+  buffer.clear();
+  buffer.push_back(static_cast<char>(s_frame_marker)); // NOLINT(bugprone-signed-char-misuse)
+  buffer.push_back(s_coalesce_tag);
+  buffer.resize(s_coalesce_header_size, 0);
+}
+
+/**
+ * @brief Append one serialized message (u32 length prefix plus payload)
+ * to an aggregate frame
+ */
+inline void
+append_coalesced_message(std::vector<char>& buffer, const char* data, uint32_t size)
+{
+  auto offset = buffer.size();
+  buffer.resize(offset + sizeof(uint32_t) + size);
+  std::memcpy(buffer.data() + offset, &size, sizeof(uint32_t));
+  std::memcpy(buffer.data() + offset + sizeof(uint32_t), data, size);
+}
+
+/**
+ * @brief Write the final message count into an aggregate frame's header
+ */
+inline void
+patch_coalesced_count(std::vector<char>& buffer, uint32_t count)
+{
+  std::memcpy(buffer.data() + 4, &count, sizeof(uint32_t));
+}
+
+/**
+ * @brief Split an aggregate frame back into the individual serialized
+ * messages it carries. Truncated frames yield only the complete messages.
+ */
+template<typename BufferType>
+std::vector<BufferType>
+split_coalesced_frame(BufferType const& data)
+{
+  std::vector<BufferType> parts;
+  uint32_t count = 0;
+  std::memcpy(&count, &data[4], sizeof(uint32_t));
+  parts.reserve(count);
+
+  size_t pos = s_coalesce_header_size;
+  while (parts.size() < count && pos + sizeof(uint32_t) <= data.size()) {
+    uint32_t len = 0;
+    std::memcpy(&len, &data[pos], sizeof(uint32_t));
+    pos += sizeof(uint32_t);
+    if (pos + len > data.size()) {
+      break;
+    }
+    parts.emplace_back(data.begin() + pos, data.begin() + pos + len);
+    pos += len;
+  }
+  return parts;
+}
+
+/**
+ * @brief Whether a received buffer is one chunk of a streamed large
+ * message (as opposed to a single plain serialized message)
+ */
+template<typename BufferType>
+bool
+is_chunk_frame(BufferType const& data)
+{
+  return data.size() >= s_chunk_header_size && static_cast<unsigned char>(data[0]) == s_frame_marker &&
+         data[1] == s_chunk_tag;
+}
+
+/**
+ * @brief Write a chunk frame header into the first s_chunk_header_size
+ * bytes of buffer (which must already be at least that large)
+ */
+inline void
+write_chunk_header(std::vector<char>& buffer, uint32_t transfer_id, uint32_t chunk_index, bool last)
+{
+  buffer[0] = static_cast<char>(s_frame_marker); // NOLINT(bugprone-signed-char-misuse)
+  buffer[1] = s_chunk_tag;
+  buffer[2] = last ? s_chunk_flag_last : 0;
+  buffer[3] = 0;
+  std::memcpy(buffer.data() + 4, &transfer_id, sizeof(uint32_t));
+  std::memcpy(buffer.data() + 8, &chunk_index, sizeof(uint32_t));
+}
+
+template<typename BufferType>
+uint32_t
+chunk_transfer_id(BufferType const& data)
+{
+  uint32_t id = 0;
+  std::memcpy(&id, &data[4], sizeof(uint32_t));
+  return id;
+}
+
+template<typename BufferType>
+uint32_t
+chunk_index(BufferType const& data)
+{
+  uint32_t index = 0;
+  std::memcpy(&index, &data[8], sizeof(uint32_t));
+  return index;
+}
+
+template<typename BufferType>
+bool
+chunk_is_last(BufferType const& data)
+{
+  return (data[2] & s_chunk_flag_last) != 0;
+}
+
+/**
+ * @brief Whether a received buffer is a raw frame, i.e. the bytes of a
+ * trivially-copyable object from a connection configured with
+ * SerializationFormat::kRaw (see Sender.hpp)
+ */
+template<typename BufferType>
+bool
+is_raw_frame(BufferType const& data)
+{
+  return data.size() >= s_raw_header_size && static_cast<unsigned char>(data[0]) == s_frame_marker &&
+         data[1] == s_raw_tag;
+}
+
+/**
+ * @brief Whether a received buffer is a topic frame, i.e. a serialized
+ * message prefixed with the topic it was published on (see
+ * TopicDemux.hpp)
+ */
+template<typename BufferType>
+bool
+is_topic_frame(BufferType const& data)
+{
+  return data.size() >= s_topic_header_size && static_cast<unsigned char>(data[0]) == s_frame_marker &&
+         data[1] == s_topic_tag;
+}
+
+/**
+ * @brief Reset buffer to a topic frame header plus the topic string; the
+ * caller appends the serialized payload
+ */
+inline void
+start_topic_frame(std::vector<char>& buffer, std::string const& topic)
+{
+  buffer.clear();
+  buffer.resize(s_topic_header_size, 0);
+  buffer[0] = static_cast<char>(s_frame_marker); // NOLINT(bugprone-signed-char-misuse)
+  buffer[1] = s_topic_tag;
+  auto len = static_cast<uint16_t>(topic.size());
+  std::memcpy(buffer.data() + 2, &len, sizeof(uint16_t));
+  buffer.insert(buffer.end(), topic.begin(), topic.end());
+}
+
+/**
+ * @brief The topic a topic frame was published on
+ */
+template<typename BufferType>
+std::string
+topic_of_frame(BufferType const& data)
+{
+  uint16_t len = 0;
+  std::memcpy(&len, &data[2], sizeof(uint16_t));
+  if (s_topic_header_size + len > data.size()) {
+    return "";
+  }
+  return std::string(&data[s_topic_header_size], len);
+}
+
+/**
+ * @brief Offset of the serialized payload within a topic frame
+ */
+template<typename BufferType>
+size_t
+topic_frame_payload_offset(BufferType const& data)
+{
+  uint16_t len = 0;
+  std::memcpy(&len, &data[2], sizeof(uint16_t));
+  return s_topic_header_size + len;
+}
+
+} // namespace framing
+} // namespace iomanager
+} // namespace dunedaq
+
+#endif // IOMANAGER_INCLUDE_IOMANAGER_MESSAGEFRAMING_HPP_
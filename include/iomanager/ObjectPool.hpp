@@ -0,0 +1,73 @@
+/**
+ * @file ObjectPool.hpp
+ *
+ * A small pool of recycled object instances, used on the receive path so
+ * datatypes that own heap buffers are not constructed and destroyed once
+ * per message.
+ *
+ * This is part of the DUNE DAQ Application Framework, copyright 2020.
+ * Licensing/copyright details are in the COPYING file that you should have
+ * received with this code.
+ */
+
+#ifndef IOMANAGER_INCLUDE_IOMANAGER_OBJECTPOOL_HPP_
+#define IOMANAGER_INCLUDE_IOMANAGER_OBJECTPOOL_HPP_
+
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace dunedaq {
+namespace iomanager {
+
+/**
+ * @brief Pool of recycled T instances.
+ *
+ * acquire() hands out a previously released instance where possible (so
+ * any internal buffers it grew stay allocated) and default-constructs one
+ * otherwise; release() returns an instance to the pool, up to the
+ * configured cache size. T must be default-constructible and movable.
+ */
+template<typename T>
+class ObjectPool
+{
+public:
+  explicit ObjectPool(size_t max_cached = 64)
+    : m_max_cached(max_cached)
+  {}
+
+  T acquire()
+  {
+    std::lock_guard<std::mutex> lk(m_mutex);
+    if (!m_cached.empty()) {
+      T obj = std::move(m_cached.back());
+      m_cached.pop_back();
+      return obj;
+    }
+    return T();
+  }
+
+  void release(T&& obj)
+  {
+    std::lock_guard<std::mutex> lk(m_mutex);
+    if (m_cached.size() < m_max_cached) {
+      m_cached.push_back(std::move(obj));
+    }
+  }
+
+  size_t size() const
+  {
+    std::lock_guard<std::mutex> lk(m_mutex);
+    return m_cached.size();
+  }
+
+private:
+  size_t m_max_cached;
+  std::vector<T> m_cached;
+  mutable std::mutex m_mutex;
+};
+
+} // namespace iomanager
+} // namespace dunedaq
+
+#endif // IOMANAGER_INCLUDE_IOMANAGER_OBJECTPOOL_HPP_
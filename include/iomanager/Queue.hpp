@@ -90,6 +90,47 @@ public:
   virtual bool try_push(value_t&& val, const duration_t& timeout) = 0;
   virtual bool try_pop(value_t& val, const duration_t& timeout) = 0;
 
+  /**
+   * @brief Push a batch of values onto the Queue.
+   * @param vals Values to push (the vector is consumed)
+   * @param timeout Timeout for each element of the push operation
+   *
+   * The default implementation pushes element-by-element; implementations
+   * with a cheaper bulk path should override it.
+   */
+  virtual void push_bulk(std::vector<value_t>&& vals, const duration_t& timeout)
+  {
+    for (auto& val : vals) {
+      push(std::move(val), timeout);
+    }
+  }
+
+  /**
+   * @brief Pop up to max_n values off of the queue
+   * @param vals Vector that is filled with the popped values
+   * @param max_n Maximum number of values to pop
+   * @param timeout Timeout waiting for the first value; the rest of the
+   * batch is whatever is immediately available
+   * @return Number of values popped
+   *
+   * The default implementation pops element-by-element; implementations
+   * with a cheaper bulk path should override it.
+   */
+  virtual size_t pop_bulk(std::vector<value_t>& vals, size_t max_n, const duration_t& timeout)
+  {
+    vals.clear();
+    vals.reserve(max_n);
+    value_t val;
+    if (!try_pop(val, timeout)) {
+      return 0;
+    }
+    vals.emplace_back(std::move(val));
+    while (vals.size() < max_n && can_pop() && try_pop(val, duration_t::zero())) {
+      vals.emplace_back(std::move(val));
+    }
+    return vals.size();
+  }
+
 private:
   Queue(const Queue&) = delete;
   Queue& operator=(const Queue&) = delete;
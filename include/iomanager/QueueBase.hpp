@@ -25,11 +25,22 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdlib>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 
 namespace dunedaq {
+
+// Disable coverage collection LCOV_EXCL_START
+ERS_DECLARE_ISSUE(iomanager,
+                  QueueTimeoutsSuppressed,
+                  "Queue " << queue_name << " timed out on " << direction << " " << count
+                           << " time(s) since the last report (timeout " << timeout_ms << " ms)",
+                  ((std::string)queue_name)((uint64_t)count)((std::string)direction)((long)timeout_ms))
+// Re-enable coverage collection LCOV_EXCL_STOP
+
 namespace iomanager {
 
 /**
@@ -56,9 +67,17 @@ public:
     queueinfo::Info info;
     info.capacity = this->get_capacity();
     info.number_of_elements = this->get_num_elements();
+    info.numa_node = m_numa_node;
+    info.push_timeouts = m_push_timeouts.load(std::memory_order_relaxed);
+    info.pop_timeouts = m_pop_timeouts.load(std::memory_order_relaxed);
     ci.add(info);
   }
 
+  /// Record the NUMA node the queue storage was placed on (set by
+  /// QueueRegistry::create_queue; -1 when no placement was requested)
+  void set_numa_node(int node) { m_numa_node = node; }
+  int get_numa_node() const { return m_numa_node; }
+
   /**
    * @brief Get the capacity (max size) of the queue
    * @return size_t capacity
@@ -67,7 +86,126 @@ public:
 
   virtual size_t get_num_elements() const = 0;
 
+  /**
+   * @brief Register watermark callbacks for event-driven flow control.
+   *
+   * on_high fires once when occupancy rises to high or above; on_low
+   * fires once when it has subsequently drained to low or below. Upstream
+   * stages can use this to throttle production before the queue fills
+   * instead of polling can_push or spinning on push timeouts. Callbacks
+   * run on the pushing/popping thread and must be cheap and non-blocking.
+   */
+  void register_watermarks(size_t high, size_t low, std::function<void()> on_high, std::function<void()> on_low)
+  {
+    m_high_watermark = high;
+    m_low_watermark = low;
+    m_on_high = on_high;
+    m_on_low = on_low;
+    m_above_high = false;
+    m_watermarks_enabled.store(true, std::memory_order_release);
+  }
+
+  void clear_watermarks() { m_watermarks_enabled.store(false, std::memory_order_release); }
+
+protected:
+  /// Implementations call this after a successful push; a single relaxed
+  /// load when no watermarks are registered
+  void note_push()
+  {
+    if (!m_watermarks_enabled.load(std::memory_order_acquire)) {
+      return;
+    }
+    if (!m_above_high.load(std::memory_order_relaxed) && get_num_elements() >= m_high_watermark) {
+      if (!m_above_high.exchange(true) && m_on_high) {
+        m_on_high();
+      }
+    }
+  }
+
+  /// Implementations call this after a successful pop
+  void note_pop()
+  {
+    if (!m_watermarks_enabled.load(std::memory_order_acquire)) {
+      return;
+    }
+    if (m_above_high.load(std::memory_order_relaxed) && get_num_elements() <= m_low_watermark) {
+      if (m_above_high.exchange(false) && m_on_low) {
+        m_on_low();
+      }
+    }
+  }
+
+  /**
+   * @brief Count a push timeout and emit a rate-limited ERS issue.
+   *
+   * Hot paths must not pay one ERS issue per failed operation: a stalled
+   * consumer behind a MHz producer would make the error reporting itself
+   * the bottleneck. Timeouts are accounted in relaxed counters (exported
+   * via get_info) and at most one QueueTimeoutsSuppressed per
+   * IOMANAGER_TIMEOUT_REPORT_MS (default 1000; 0 disables reporting) is
+   * emitted per queue, carrying the number of timeouts since the last
+   * report.
+   */
+  void note_push_timeout(long timeout_ms)
+  {
+    m_push_timeouts.fetch_add(1, std::memory_order_relaxed);
+    maybe_report_timeouts("push", timeout_ms);
+  }
+
+  /// See note_push_timeout. Implementations only call this for waits
+  /// with a nonzero timeout; a zero-timeout miss is a poll, not an error.
+  void note_pop_timeout(long timeout_ms)
+  {
+    m_pop_timeouts.fetch_add(1, std::memory_order_relaxed);
+    maybe_report_timeouts("pop", timeout_ms);
+  }
+
 private:
+  static std::chrono::milliseconds timeout_report_interval()
+  {
+    static std::chrono::milliseconds interval = []() {
+      char* env = getenv("IOMANAGER_TIMEOUT_REPORT_MS"); // NOLINT(concurrency-mt-unsafe)
+      if (env == nullptr) {
+        return std::chrono::milliseconds(1000);
+      }
+      return std::chrono::milliseconds(strtoul(env, nullptr, 0)); // NOLINT(runtime/threadsafe_fn)
+    }();
+    return interval;
+  }
+
+  void maybe_report_timeouts(const char* direction, long timeout_ms)
+  {
+    auto interval = timeout_report_interval();
+    if (interval.count() == 0) {
+      return;
+    }
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    auto last = m_last_timeout_report.load(std::memory_order_relaxed);
+    if (now - std::chrono::steady_clock::duration(last) < interval) {
+      return;
+    }
+    // The compare_exchange elects one thread to report for this interval
+    if (!m_last_timeout_report.compare_exchange_strong(last, now.count(), std::memory_order_relaxed)) {
+      return;
+    }
+    auto total = m_push_timeouts.load(std::memory_order_relaxed) + m_pop_timeouts.load(std::memory_order_relaxed);
+    auto since_last = total - m_timeouts_at_last_report.exchange(total, std::memory_order_relaxed);
+    ers::error(QueueTimeoutsSuppressed(ERS_HERE, get_name(), since_last, direction, timeout_ms));
+  }
+  std::atomic<bool> m_watermarks_enabled{ false };
+  std::atomic<bool> m_above_high{ false };
+  size_t m_high_watermark{ 0 };
+  size_t m_low_watermark{ 0 };
+  std::function<void()> m_on_high;
+  std::function<void()> m_on_low;
+  int m_numa_node{ -1 };
+
+  // Timeout accounting, see note_push_timeout
+  std::atomic<uint64_t> m_push_timeouts{ 0 };
+  std::atomic<uint64_t> m_pop_timeouts{ 0 };
+  std::atomic<std::chrono::steady_clock::duration::rep> m_last_timeout_report{ 0 };
+  std::atomic<uint64_t> m_timeouts_at_last_report{ 0 };
+
   QueueBase(const QueueBase&) = delete;
   QueueBase& operator=(const QueueBase&) = delete;
   QueueBase(QueueBase&&) = default;
@@ -19,6 +19,10 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <sched.h>
 
 namespace dunedaq {
 namespace iomanager {
@@ -41,6 +45,8 @@ struct QueueConfig
     kStdDeQueue = 1, ///< The StdDeQueue
     kFollySPSCQueue = 2,
     kFollyMPMCQueue = 3,
+    kFollyMPSCQueue = 4,
+    kFollyUnboundedQueue = 5,
   };
 
   /**
@@ -53,6 +59,8 @@ struct QueueConfig
   QueueConfig::queue_kind kind = queue_kind::kUnknown; ///< The kind of Queue represented by this
                                                        ///< QueueConfig
   size_t capacity = 0;                                 ///< The maximum size of the queue
+  int numa_node = -1;                                  ///< NUMA node on which to allocate the queue
+                                                       ///< storage (-1 for no preference)
 };
 
 /**
@@ -97,7 +105,7 @@ public:
 private:
   struct QueueEntry
   {
-    const std::type_info* m_type;
+    const std::type_info* m_type{ nullptr };
     std::shared_ptr<QueueBase> m_instance;
   };
 
@@ -106,8 +114,18 @@ private:
   template<typename T>
   std::shared_ptr<QueueBase> create_queue(const std::string& name, const QueueConfig& config);
 
-  std::map<std::string, QueueEntry> m_queue_registry;
-  std::map<std::string, QueueConfig> m_queue_config_map;
+  // NUMA placement helpers, used by create_queue to first-touch queue
+  // storage on the configured node
+  static bool bind_thread_to_numa_node(int node, cpu_set_t& previous);
+  static void restore_thread_affinity(const cpu_set_t& previous);
+
+  // Queue names are interned to dense indexes at configure() time, so a
+  // get_queue lookup is one hash probe plus an array index instead of a
+  // red-black-tree walk doing a string compare at every node
+  std::unordered_map<std::string, size_t> m_queue_index;
+  std::vector<std::string> m_queue_names;
+  std::vector<QueueConfig> m_queue_configs;
+  std::vector<QueueEntry> m_queue_registry;
 
   bool m_configured{ false };
 
@@ -156,6 +174,14 @@ ERS_DECLARE_ISSUE(iomanager,               // namespace
                   "QueueRegistry already configured",
                   ERS_EMPTY)
 
+/**
+ * @brief NumaPlacementFailed ERS Issue
+ */
+ERS_DECLARE_ISSUE(iomanager,          // namespace
+                  NumaPlacementFailed, // issue class name
+                  "Could not place queue storage on NUMA node " << node << ": " << reason,
+                  ((int)node)((std::string)reason))
+
 // Re-enable coverage collection LCOV_EXCL_STOP
 } // namespace dunedaq
 
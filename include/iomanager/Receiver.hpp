@@ -9,10 +9,15 @@
 #ifndef IOMANAGER_INCLUDE_IOMANAGER_RECEIVER_HPP_
 #define IOMANAGER_INCLUDE_IOMANAGER_RECEIVER_HPP_
 
+#include "iomanager/CallbackDispatcher.hpp"
 #include "iomanager/CommonIssues.hpp"
 #include "iomanager/ConnectionId.hpp"
+#include "iomanager/MessageFraming.hpp"
+#include "iomanager/ObjectPool.hpp"
+#include "iomanager/connectioninfo/InfoNljs.hpp"
 
 #include "iomanager/QueueRegistry.hpp"
+#include "iomanager/TopicDemux.hpp"
 #include "ipm/Subscriber.hpp"
 #include "logging/Logging.hpp"
 #include "networkmanager/NetworkManager.hpp"
@@ -20,12 +25,19 @@
 #include "utilities/ReusableThread.hpp"
 
 #include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <map>
 #include <memory>
 #include <optional>
 #include <string>
 #include <thread>
+#include <type_traits>
 #include <typeinfo>
 #include <utility>
+#include <vector>
 
 namespace dunedaq {
 
@@ -34,6 +46,10 @@ ERS_DECLARE_ISSUE(iomanager,
                   ReceiveCallbackConflict,
                   "QueueReceiverModel for uid " << conn_uid << " is equipped with callback! Ignoring receive call.",
                   ((std::string)conn_uid))
+ERS_DECLARE_ISSUE(iomanager,
+                  ChunkedTransferDiscarded,
+                  "Discarding " << count << " incomplete chunked transfer(s) on connection " << conn_uid,
+                  ((size_t)count)((std::string)conn_uid))
 // Re-enable coverage collection LCOV_EXCL_STOP
 
 namespace iomanager {
@@ -56,9 +72,28 @@ public:
   ConnectionId const conn_id() const { return m_conn_id; }
   ConnectionRef const conn_ref() const { return m_conn_ref; }
 
+  /**
+   * @brief Method to retrieve hot-path counters from this connection for
+   * operational monitoring
+   */
+  void get_info(opmonlib::InfoCollector& ci, int /*level*/)
+  {
+    connectioninfo::ReceiverInfo info;
+    info.received_messages = m_received_messages.load(std::memory_order_relaxed);
+    info.received_bytes = m_received_bytes.load(std::memory_order_relaxed);
+    info.receive_timeouts = m_receive_timeouts.load(std::memory_order_relaxed);
+    ci.add(info);
+  }
+
 protected:
   ConnectionId m_conn_id;
   ConnectionRef m_conn_ref;
+
+  // Hot-path counters; only ever incremented with relaxed atomics so the
+  // bookkeeping stays cheap
+  std::atomic<uint64_t> m_received_messages{ 0 };
+  std::atomic<uint64_t> m_received_bytes{ 0 };
+  std::atomic<uint64_t> m_receive_timeouts{ 0 };
 };
 
 // Interface
@@ -71,8 +106,37 @@ public:
   {}
   virtual Datatype receive(Receiver::timeout_t timeout) = 0;
   virtual std::optional<Datatype> try_receive(Receiver::timeout_t timeout) = 0;
+
+  /**
+   * Receive up to max_n messages in one call. Implementations wait at most
+   * timeout for the first message, then drain whatever else is immediately
+   * available, so the per-receive overhead is amortized over the batch.
+   */
+  virtual std::vector<Datatype> receive_batch(size_t max_n, Receiver::timeout_t timeout) = 0;
+
+  /**
+   * Receive into a caller-supplied instance instead of returning a fresh
+   * one, so the hot path performs no per-message construction. Combined
+   * with pool(), steady-state receives recycle instances (and whatever
+   * buffers they own):
+   *
+   *   auto obj = receiver->pool().acquire();
+   *   receiver->receive_into(obj, timeout);
+   *   // ... process obj ...
+   *   receiver->pool().release(std::move(obj));
+   *
+   * Throws TimeoutExpired like receive().
+   */
+  virtual void receive_into(Datatype& dt, Receiver::timeout_t timeout) = 0;
+
+  /// Per-receiver pool of recycled Datatype instances, see receive_into()
+  ObjectPool<Datatype>& pool() { return m_pool; }
+
   virtual void add_callback(std::function<void(Datatype&)> callback) = 0;
   virtual void remove_callback() = 0;
+
+private:
+  ObjectPool<Datatype> m_pool;
 };
 
 // QImpl
@@ -95,9 +159,11 @@ public:
     : ReceiverConcept<Datatype>(other.m_conn_id, other.m_conn_ref)
     , m_with_callback(other.m_with_callback.load())
     , m_callback(std::move(other.m_callback))
-    , m_event_loop_runner(std::move(other.m_event_loop_runner))
+    , m_callback_handle(other.m_callback_handle)
     , m_queue(other.m_queue)
-  {}
+  {
+    other.m_callback_handle = 0;
+  }
 
   ~QueueReceiverModel() { remove_callback(); }
 
@@ -115,8 +181,10 @@ public:
     try {
       m_queue->pop(dt, timeout);
     } catch (QueueTimeoutExpired& ex) {
+      this->m_receive_timeouts.fetch_add(1, std::memory_order_relaxed);
       throw TimeoutExpired(ERS_HERE, this->conn_id().uid, "pop", timeout.count(), ex);
     }
+    this->m_received_messages.fetch_add(1, std::memory_order_relaxed);
     return dt;
     // if (m_queue->write(
   }
@@ -136,40 +204,76 @@ public:
     Datatype dt;
     auto ret = m_queue->try_pop(dt, timeout);
     if (ret) {
+      this->m_received_messages.fetch_add(1, std::memory_order_relaxed);
       return std::make_optional(std::move(dt));
     }
+    this->m_receive_timeouts.fetch_add(1, std::memory_order_relaxed);
     return std::nullopt;
     // if (m_queue->write(
   }
 
+  std::vector<Datatype> receive_batch(size_t max_n, Receiver::timeout_t timeout) override
+  {
+    if (m_with_callback) {
+      TLOG() << "QueueReceiver model is equipped with callback! Ignoring receive call.";
+      throw ReceiveCallbackConflict(ERS_HERE, this->conn_id().uid);
+    }
+    if (m_queue == nullptr) {
+      throw ConnectionInstanceNotFound(ERS_HERE, this->conn_id().uid);
+    }
+
+    std::vector<Datatype> batch;
+    m_queue->pop_bulk(batch, max_n, timeout);
+    this->m_received_messages.fetch_add(batch.size(), std::memory_order_relaxed);
+    return batch;
+  }
+
+  void receive_into(Datatype& dt, Receiver::timeout_t timeout) override
+  {
+    if (m_with_callback) {
+      TLOG() << "QueueReceiver model is equipped with callback! Ignoring receive call.";
+      throw ReceiveCallbackConflict(ERS_HERE, this->conn_id().uid);
+    }
+    if (m_queue == nullptr) {
+      throw ConnectionInstanceNotFound(ERS_HERE, this->conn_id().uid);
+    }
+    try {
+      m_queue->pop(dt, timeout);
+    } catch (QueueTimeoutExpired& ex) {
+      this->m_receive_timeouts.fetch_add(1, std::memory_order_relaxed);
+      throw TimeoutExpired(ERS_HERE, this->conn_id().uid, "pop", timeout.count(), ex);
+    }
+    this->m_received_messages.fetch_add(1, std::memory_order_relaxed);
+  }
+
   void add_callback(std::function<void(Datatype&)> callback) override
   {
     remove_callback();
     TLOG() << "Registering callback.";
     m_callback = callback;
     m_with_callback = true;
-    // start event loop (thread that calls when receive happens)
-    m_event_loop_runner.reset(new std::thread([&]() {
-      Datatype dt;
-      bool ret = true;
-      while (m_with_callback.load() || ret) {
+    // register event loop with the shared dispatcher (poll is invoked when
+    // a worker sweeps this receiver). The single dt instance is reused
+    // across polls so the loop does no per-message construction.
+    m_callback_handle = CallbackDispatcher::get().register_pollable(
+      [this, dt = Datatype()]() mutable {
         // TLOG() << "Take data from q then invoke callback...";
-        ret = m_queue->try_pop(dt, std::chrono::milliseconds(1));
-        if (ret) {
+        if (m_queue->try_pop(dt, Receiver::s_no_block)) {
           m_callback(dt);
+          this->m_received_messages.fetch_add(1, std::memory_order_relaxed);
+          return true;
         }
-      }
-    }));
+        return false;
+      },
+      this->conn_ref().priority);
   }
 
   void remove_callback() override
   {
     m_with_callback = false;
-    if (m_event_loop_runner != nullptr && m_event_loop_runner->joinable()) {
-      m_event_loop_runner->join();
-      m_event_loop_runner.reset(nullptr);
-    } else if (m_event_loop_runner != nullptr) {
-      TLOG() << "Event loop can't be closed!";
+    if (m_callback_handle != 0) {
+      CallbackDispatcher::get().unregister_pollable(m_callback_handle);
+      m_callback_handle = 0;
     }
     // remove function.
   }
@@ -177,7 +281,7 @@ public:
 private:
   std::atomic<bool> m_with_callback{ false };
   std::function<void(Datatype&)> m_callback;
-  std::unique_ptr<std::thread> m_event_loop_runner;
+  CallbackDispatcher::handle_t m_callback_handle{ 0 };
   std::shared_ptr<Queue<Datatype>> m_queue;
 };
 
@@ -195,13 +299,36 @@ public:
     if (conn_id.service_type == ServiceType::kNetReceiver) {
 
       try {
-        m_network_receiver_ptr = networkmanager::NetworkManager::get().get_receiver(conn_id.uid);
+        auto endpoints = endpoints_of_uri(conn_id.uri);
+        if (endpoints.size() > 1) {
+          // Striped connection: one ipm receiver per endpoint, merged by
+          // receive_striped
+          for (size_t idx = 0; idx < endpoints.size(); ++idx) {
+            m_stripe_receivers.push_back(
+              networkmanager::NetworkManager::get().get_receiver(conn_id.uid + "#" + std::to_string(idx)));
+          }
+        } else {
+          m_network_receiver_ptr = networkmanager::NetworkManager::get().get_receiver(conn_id.uid);
+        }
       } catch (networkmanager::ConnectionNotFound& ex) {
         throw ConnectionInstanceNotFound(ERS_HERE, conn_id.uid, ex);
       }
     } else {
       try {
-        if (ref_to_topic) {
+        if (ref_to_topic && TopicDemux::enabled()) {
+          // All topic-level receivers of this connection share one
+          // socket; the connection's TopicDemux reader routes
+          // topic-framed messages into this receiver's queue
+          auto subscriber =
+            std::dynamic_pointer_cast<ipm::Subscriber>(networkmanager::NetworkManager::get().get_receiver(conn_id.uid));
+          if (subscriber == nullptr) {
+            // The connection's receiver is not a Subscriber, so there is
+            // nothing the demux reader thread could safely poll
+            throw ConnectionInstanceNotFound(ERS_HERE, conn_id.uid);
+          }
+          m_demux = TopicDemux::get(conn_id.uid, subscriber);
+          m_demux_queue = m_demux->subscribe(conn_ref.uid);
+        } else if (ref_to_topic) {
           m_network_subscriber_ptr = networkmanager::NetworkManager::get().get_subscriber(conn_ref.uid);
         } else {
           m_network_subscriber_ptr =
@@ -218,16 +345,22 @@ public:
     : ReceiverConcept<Datatype>(other.m_conn_id, other.m_conn_ref)
     , m_with_callback(other.m_with_callback.load())
     , m_callback(std::move(other.m_callback))
-    , m_event_loop_runner(std::move(other.m_event_loop_runner))
+    , m_callback_handle(other.m_callback_handle)
     , m_network_receiver_ptr(other.m_network_receiver_ptr)
     , m_network_subscriber_ptr(other.m_network_subscriber_ptr)
-  {}
+    , m_stripe_receivers(other.m_stripe_receivers)
+    , m_demux(other.m_demux)
+    , m_demux_queue(other.m_demux_queue)
+  {
+    other.m_callback_handle = 0;
+  }
 
   Datatype receive(Receiver::timeout_t timeout) override
   {
     try {
       return read_network<Datatype>(timeout);
     } catch (ipm::ReceiveTimeoutExpired& ex) {
+      this->m_receive_timeouts.fetch_add(1, std::memory_order_relaxed);
       throw TimeoutExpired(ERS_HERE, this->conn_ref().uid, "receive", timeout.count(), ex);
     }
   }
@@ -236,17 +369,44 @@ public:
   {
     return try_read_network<Datatype>(timeout);
   }
+
+  void receive_into(Datatype& dt, Receiver::timeout_t timeout) override
+  {
+    try {
+      dt = read_network<Datatype>(timeout);
+    } catch (ipm::ReceiveTimeoutExpired& ex) {
+      this->m_receive_timeouts.fetch_add(1, std::memory_order_relaxed);
+      throw TimeoutExpired(ERS_HERE, this->conn_ref().uid, "receive", timeout.count(), ex);
+    }
+  }
+
+  std::vector<Datatype> receive_batch(size_t max_n, Receiver::timeout_t timeout) override
+  {
+    std::vector<Datatype> batch;
+    batch.reserve(max_n);
+    // Only wait for the first message; the rest of the batch is whatever is
+    // already on the socket
+    auto message = try_read_network<Datatype>(timeout);
+    while (message) {
+      batch.emplace_back(std::move(*message));
+      if (batch.size() >= max_n) {
+        break;
+      }
+      message = try_read_network<Datatype>(Receiver::s_no_block);
+    }
+    return batch;
+  }
+
   void add_callback(std::function<void(Datatype&)> callback) { add_callback_impl<Datatype>(callback); }
 
   void remove_callback() override
   {
     std::lock_guard<std::mutex> lk(m_callback_mutex);
     m_with_callback = false;
-    if (m_event_loop_runner != nullptr && m_event_loop_runner->joinable()) {
-      m_event_loop_runner->join();
-      m_event_loop_runner.reset(nullptr);
-    } else if (m_event_loop_runner != nullptr) {
-      TLOG() << "Event loop can't be closed!";
+    stop_pipeline();
+    if (m_callback_handle != 0) {
+      CallbackDispatcher::get().unregister_pollable(m_callback_handle);
+      m_callback_handle = 0;
     }
     // remove function.
   }
@@ -256,21 +416,56 @@ private:
   typename std::enable_if<dunedaq::serialization::is_serializable<MessageType>::value, MessageType>::type read_network(
     Receiver::timeout_t const& timeout)
   {
-    std::lock_guard<std::mutex> lk(m_receive_mutex);
+    // Only the socket access is serialized; deserialization happens
+    // outside the lock so concurrent readers overlap the expensive part
+    ipm::Receiver::Response response;
+    if (m_demux_queue != nullptr) {
+      // Messages for this topic arrive through the connection's shared
+      // TopicDemux reader, already unframed
+      if (timeout == Receiver::s_block) {
+        m_demux_queue->dequeue(response.data);
+      } else if (!m_demux_queue->try_dequeue_for(response.data, timeout)) {
+        this->m_receive_timeouts.fetch_add(1, std::memory_order_relaxed);
+        throw TimeoutExpired(ERS_HERE, this->conn_id().uid, "network receive", timeout.count());
+      }
+    } else {
+      std::lock_guard<std::mutex> lk(m_receive_mutex);
+
+      if (!m_pending_messages.empty()) {
+        response.data = std::move(m_pending_messages.front());
+        m_pending_messages.pop_front();
+      } else if (!m_stripe_receivers.empty()) {
+        response = receive_striped(timeout);
+      } else if (m_network_subscriber_ptr != nullptr) {
+        response = m_network_subscriber_ptr->receive(timeout);
+      } else if (m_network_receiver_ptr != nullptr) {
+        response = m_network_receiver_ptr->receive(timeout);
+      }
 
-    if (m_network_subscriber_ptr != nullptr) {
-      auto response = m_network_subscriber_ptr->receive(timeout);
-      if (response.data.size() > 0) {
-        return dunedaq::serialization::deserialize<MessageType>(response.data);
+      // Chunked transfers: keep pulling frames until one completes into a
+      // whole message (or an unrelated plain message arrives)
+      while (framing::is_chunk_frame(response.data)) {
+        if (reassemble_chunk(response)) {
+          break;
+        }
+        if (m_network_subscriber_ptr != nullptr) {
+          response = m_network_subscriber_ptr->receive(timeout);
+        } else if (m_network_receiver_ptr != nullptr) {
+          response = m_network_receiver_ptr->receive(timeout);
+        }
       }
     }
-    if (m_network_receiver_ptr != nullptr) {
-      auto response = m_network_receiver_ptr->receive(timeout);
-      if (response.data.size() > 0) {
-        return dunedaq::serialization::deserialize<MessageType>(response.data);
-      }
+
+    unpack_coalesced_frame(response);
+    strip_topic_frame(response);
+
+    if (response.data.size() > 0) {
+      this->m_received_messages.fetch_add(1, std::memory_order_relaxed);
+      this->m_received_bytes.fetch_add(response.data.size(), std::memory_order_relaxed);
+      return decode<MessageType>(response.data);
     }
 
+    this->m_receive_timeouts.fetch_add(1, std::memory_order_relaxed);
     throw TimeoutExpired(ERS_HERE, this->conn_id().uid, "network receive", timeout.count());
     return MessageType();
   }
@@ -287,18 +482,56 @@ private:
   typename std::enable_if<dunedaq::serialization::is_serializable<MessageType>::value, std::optional<MessageType>>::type
       try_read_network(Receiver::timeout_t const& timeout)
   {
+    // As in read_network, deserialize outside the socket lock
     ipm::Receiver::Response res;
-    std::lock_guard<std::mutex> lk(m_receive_mutex);
+    if (m_demux_queue != nullptr) {
+      // See read_network: demuxed topics drain their per-topic queue
+      if (!m_demux_queue->try_dequeue_for(res.data, timeout)) {
+        return std::nullopt;
+      }
+    } else {
+      std::lock_guard<std::mutex> lk(m_receive_mutex);
+
+      if (!m_pending_messages.empty()) {
+        res.data = std::move(m_pending_messages.front());
+        m_pending_messages.pop_front();
+      } else if (!m_stripe_receivers.empty()) {
+        res = receive_striped(timeout);
+      } else {
+        if (m_network_subscriber_ptr != nullptr) {
+          res = m_network_subscriber_ptr->receive(timeout, ipm::Receiver::s_any_size, true);
+        }
+        if (m_network_receiver_ptr != nullptr) {
+          res = m_network_receiver_ptr->receive(timeout, ipm::Receiver::s_any_size, true);
+        }
+      }
 
-    if (m_network_subscriber_ptr != nullptr) {
-      res = m_network_subscriber_ptr->receive(timeout, ipm::Receiver::s_any_size, true);
-    }
-    if (m_network_receiver_ptr != nullptr) {
-      res = m_network_receiver_ptr->receive(timeout, ipm::Receiver::s_any_size, true);
+      // As in read_network, complete any in-flight chunked transfer; if
+      // the remaining chunks are not on the socket yet, the partial stays
+      // in the reassembly map and this call reports no message
+      while (framing::is_chunk_frame(res.data)) {
+        if (reassemble_chunk(res)) {
+          break;
+        }
+        if (m_network_subscriber_ptr != nullptr) {
+          res = m_network_subscriber_ptr->receive(timeout, ipm::Receiver::s_any_size, true);
+        }
+        if (m_network_receiver_ptr != nullptr) {
+          res = m_network_receiver_ptr->receive(timeout, ipm::Receiver::s_any_size, true);
+        }
+        if (res.data.size() == 0) {
+          break;
+        }
+      }
     }
 
+    unpack_coalesced_frame(res);
+    strip_topic_frame(res);
+
     if (res.data.size() > 0) {
-      return std::make_optional<MessageType>(dunedaq::serialization::deserialize<MessageType>(res.data));
+      this->m_received_messages.fetch_add(1, std::memory_order_relaxed);
+      this->m_received_bytes.fetch_add(res.data.size(), std::memory_order_relaxed);
+      return std::make_optional<MessageType>(decode<MessageType>(res.data));
     }
 
     return std::nullopt;
@@ -324,20 +557,31 @@ private:
     TLOG() << "Registering callback.";
     m_callback = callback;
     m_with_callback = true;
-    // start event loop (thread that calls when receive happens)
-    m_event_loop_runner.reset(new std::thread([&]() {
-        std::optional<Datatype> message;
-      while (m_with_callback.load() || message ) {
+
+    // When a deserializer pool is requested, run a dedicated pipeline for
+    // this connection instead of polling through the shared dispatcher
+    auto num_workers = deserializer_pool_size();
+    if (num_workers > 0) {
+      start_pipeline<MessageType>(num_workers);
+      return;
+    }
+
+    // register event loop with the shared dispatcher (poll is invoked when
+    // a worker sweeps this receiver)
+    m_callback_handle = CallbackDispatcher::get().register_pollable(
+      [&]() {
         try {
-          message = try_read_network<Datatype>(std::chrono::milliseconds(1));
+          auto message = try_read_network<Datatype>(Receiver::s_no_block);
           if (message) {
-              m_callback(*message);
+            m_callback(*message);
+            return true;
           }
         } catch (const ers::Issue&) {
           ;
         }
-      }
-    }));
+        return false;
+      },
+      this->conn_ref().priority);
   }
 
   template<typename MessageType>
@@ -347,13 +591,333 @@ private:
     throw NetworkMessageNotSerializable(ERS_HERE, typeid(MessageType).name());
   }
 
+  /**
+   * @brief If response holds a coalesced aggregate frame (see
+   * MessageFraming.hpp), replace it with the first message it carries and
+   * stash the rest on m_pending_messages to be served by subsequent
+   * receives. A no-op for plain messages.
+   */
+  void unpack_coalesced_frame(ipm::Receiver::Response& response)
+  {
+    if (!framing::is_coalesced_frame(response.data)) {
+      return;
+    }
+    auto parts = framing::split_coalesced_frame(response.data);
+    if (parts.empty()) {
+      response.data.clear();
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lk(m_receive_mutex);
+      for (size_t idx = 1; idx < parts.size(); ++idx) {
+        m_pending_messages.push_back(std::move(parts[idx]));
+      }
+    }
+    response.data = std::move(parts[0]);
+  }
+
+  /**
+   * @brief Receive the next message from any stripe of a striped
+   * connection (see NetworkSenderModel::write_striped). Sweeps the stripe
+   * sockets without blocking, parking briefly on a rotating stripe
+   * between empty sweeps so an idle connection does not spin. Per-stripe
+   * ordering is preserved since each socket is drained in order; ordering
+   * across stripes is not, which the sender-side round-robin already gave
+   * up. Returns an empty response on timeout. Must be called with
+   * m_receive_mutex held.
+   */
+  ipm::Receiver::Response receive_striped(Receiver::timeout_t const& timeout)
+  {
+    static constexpr Receiver::timeout_t s_stripe_park{ 1 };
+    auto start_time = std::chrono::steady_clock::now();
+    ipm::Receiver::Response response;
+    while (true) {
+      for (size_t sweep = 0; sweep < m_stripe_receivers.size(); ++sweep) {
+        auto& stripe = m_stripe_receivers[m_next_stripe++ % m_stripe_receivers.size()];
+        response = stripe->receive(Receiver::s_no_block, ipm::Receiver::s_any_size, true);
+        if (response.data.size() > 0) {
+          return response;
+        }
+      }
+      if (timeout != Receiver::s_block && std::chrono::steady_clock::now() - start_time >= timeout) {
+        return response;
+      }
+      auto& stripe = m_stripe_receivers[m_next_stripe++ % m_stripe_receivers.size()];
+      response = stripe->receive(s_stripe_park, ipm::Receiver::s_any_size, true);
+      if (response.data.size() > 0) {
+        return response;
+      }
+    }
+  }
+
+  /**
+   * @brief Decode one received payload into a message. Raw frames from
+   * connections configured with SerializationFormat::kRaw are memcpy'd
+   * straight into the message when the type is trivially copyable (see
+   * NetworkSenderModel::init_serialization); everything else goes through
+   * the serialization library as before. The frame marker makes the
+   * format self-describing, so no receiver-side configuration is needed.
+   */
+  template<typename MessageType, typename BufferType>
+  MessageType decode(BufferType const& data)
+  {
+    if constexpr (std::is_trivially_copyable_v<MessageType>) {
+      if (framing::is_raw_frame(data)) {
+        if (data.size() != framing::s_raw_header_size + sizeof(MessageType)) {
+          throw RawMessageSizeMismatch(ERS_HERE,
+                                       this->conn_id().uid,
+                                       data.size() - framing::s_raw_header_size,
+                                       typeid(MessageType).name(),
+                                       sizeof(MessageType));
+        }
+        MessageType message;
+        std::memcpy(&message, data.data() + framing::s_raw_header_size, sizeof(MessageType));
+        return message;
+      }
+    }
+    return dunedaq::serialization::deserialize<MessageType>(data);
+  }
+
+  /**
+   * @brief If response holds a topic frame (added by publishing senders
+   * when topic demultiplexing is enabled, see TopicDemux.hpp), drop the
+   * topic prefix so only the serialized payload remains. A no-op for
+   * plain messages, so non-demuxing receivers interoperate with
+   * topic-framing senders.
+   */
+  void strip_topic_frame(ipm::Receiver::Response& response)
+  {
+    if (!framing::is_topic_frame(response.data)) {
+      return;
+    }
+    auto offset = framing::topic_frame_payload_offset(response.data);
+    if (offset >= response.data.size()) {
+      response.data.clear();
+      return;
+    }
+    response.data.erase(response.data.begin(), response.data.begin() + offset);
+  }
+
+  /**
+   * @brief Accumulate one chunk frame of a streamed large message (see
+   * MessageFraming.hpp and NetworkSenderModel's chunked streaming mode).
+   * Returns true when the chunk completed its transfer, leaving the
+   * reassembled serialized message in response.data; returns false (and
+   * clears response.data) while more chunks are outstanding. Must be
+   * called with m_receive_mutex held.
+   */
+  bool reassemble_chunk(ipm::Receiver::Response& response)
+  {
+    auto id = framing::chunk_transfer_id(response.data);
+    if (framing::chunk_index(response.data) == 0) {
+      // A transfer id restarting at chunk 0 replaces any stale partial
+      // (e.g. from a sender whose earlier transfer timed out mid-way)
+      m_reassembly[id].clear();
+      if (m_reassembly.size() > s_max_reassembly) {
+        ers::warning(ChunkedTransferDiscarded(ERS_HERE, m_reassembly.size() - 1, this->conn_id().uid));
+        auto current = std::move(m_reassembly[id]);
+        m_reassembly.clear();
+        m_reassembly[id] = std::move(current);
+      }
+    }
+    auto& partial = m_reassembly[id];
+    partial.insert(partial.end(), response.data.begin() + framing::s_chunk_header_size, response.data.end());
+    if (!framing::chunk_is_last(response.data)) {
+      response.data.clear();
+      return false;
+    }
+    response.data = std::move(partial);
+    m_reassembly.erase(id);
+    return true;
+  }
+
+  /**
+   * @brief Number of deserializer workers to run per callback connection,
+   * taken from the IOMANAGER_DESERIALIZER_THREADS environment variable. 0
+   * (the default) keeps the shared-dispatcher polling path.
+   */
+  static size_t deserializer_pool_size()
+  {
+    char* env = getenv("IOMANAGER_DESERIALIZER_THREADS"); // NOLINT(concurrency-mt-unsafe)
+    if (env == nullptr) {
+      return 0;
+    }
+    return strtoul(env, nullptr, 0); // NOLINT(runtime/threadsafe_fn)
+  }
+
+  /**
+   * @brief Start the pipelined receive engine: one socket-reader thread
+   * feeds raw responses into a bounded buffer drained by num_workers
+   * deserializer threads which invoke the callback. Decode then runs in
+   * parallel with the socket read (and, with more than one worker, with
+   * itself). A pool of size 1 preserves message ordering; larger pools
+   * trade ordering for decode throughput.
+   */
+  template<typename MessageType>
+  void start_pipeline(size_t num_workers)
+  {
+    m_pipeline_running = true;
+
+    m_pipeline_reader = std::thread([this]() {
+      // A short blocking receive keeps the reader responsive to shutdown
+      // without spinning when the connection is idle
+      static constexpr Receiver::timeout_t s_reader_timeout{ 10 };
+      while (m_pipeline_running.load()) {
+        ipm::Receiver::Response response;
+        // As in the dispatcher poll path, a transport or framing error
+        // must not escape the thread body (which would terminate the
+        // process); report it and keep reading
+        try {
+          if (m_demux_queue != nullptr) {
+            m_demux_queue->try_dequeue_for(response.data, s_reader_timeout);
+          } else {
+            std::lock_guard<std::mutex> lk(m_receive_mutex);
+            if (!m_stripe_receivers.empty()) {
+              response = receive_striped(s_reader_timeout);
+            } else if (m_network_subscriber_ptr != nullptr) {
+              response = m_network_subscriber_ptr->receive(s_reader_timeout, ipm::Receiver::s_any_size, true);
+            } else if (m_network_receiver_ptr != nullptr) {
+              response = m_network_receiver_ptr->receive(s_reader_timeout, ipm::Receiver::s_any_size, true);
+            }
+            // Chunk frames are reassembled here in the reader so workers
+            // only ever see complete serialized messages
+            if (framing::is_chunk_frame(response.data)) {
+              reassemble_chunk(response);
+            }
+          }
+        } catch (const ers::Issue& ex) {
+          ers::warning(ex);
+          continue;
+        } catch (const std::exception& ex) {
+          ers::warning(OperationFailed(
+            ERS_HERE, "pipeline reader for " + this->conn_id().uid + " dropped a message: " + ex.what()));
+          continue;
+        }
+        if (response.data.size() == 0) {
+          continue;
+        }
+
+        std::unique_lock<std::mutex> lk(m_pipeline_mutex);
+        m_pipeline_not_full.wait(
+          lk, [&]() { return m_pipeline_buffer.size() < s_pipeline_capacity || !m_pipeline_running.load(); });
+        if (!m_pipeline_running.load()) {
+          break;
+        }
+        m_pipeline_buffer.push_back(std::move(response));
+        m_pipeline_not_empty.notify_one();
+      }
+    });
+
+    for (size_t idx = 0; idx < num_workers; ++idx) {
+      m_pipeline_workers.emplace_back([this]() {
+        while (true) {
+          ipm::Receiver::Response response;
+          {
+            std::unique_lock<std::mutex> lk(m_pipeline_mutex);
+            m_pipeline_not_empty.wait(lk,
+                                      [&]() { return !m_pipeline_buffer.empty() || !m_pipeline_running.load(); });
+            if (m_pipeline_buffer.empty()) {
+              // shut down, and the buffer has been drained
+              return;
+            }
+            response = std::move(m_pipeline_buffer.front());
+            m_pipeline_buffer.pop_front();
+            m_pipeline_not_full.notify_one();
+          }
+          // A payload that fails to decode (or a callback that throws)
+          // must not take the worker down with std::terminate; remote
+          // input is not trusted to be well-formed. Report and drop, as
+          // the dispatcher poll path does.
+          try {
+            if (framing::is_coalesced_frame(response.data)) {
+              auto parts = framing::split_coalesced_frame(response.data);
+              for (auto& part : parts) {
+                if (framing::is_topic_frame(part)) {
+                  part.erase(part.begin(), part.begin() + framing::topic_frame_payload_offset(part));
+                }
+                auto message = decode<MessageType>(part);
+                m_callback(message);
+                this->m_received_messages.fetch_add(1, std::memory_order_relaxed);
+                this->m_received_bytes.fetch_add(part.size(), std::memory_order_relaxed);
+              }
+              continue;
+            }
+            strip_topic_frame(response);
+            auto message = decode<MessageType>(response.data);
+            m_callback(message);
+            this->m_received_messages.fetch_add(1, std::memory_order_relaxed);
+            this->m_received_bytes.fetch_add(response.data.size(), std::memory_order_relaxed);
+          } catch (const ers::Issue& ex) {
+            ers::warning(ex);
+          } catch (const std::exception& ex) {
+            // msgpack unpack errors are plain std::exceptions
+            ers::warning(OperationFailed(
+              ERS_HERE, "pipeline worker for " + this->conn_id().uid + " dropped a message: " + ex.what()));
+          }
+        }
+      });
+    }
+  }
+
+  void stop_pipeline()
+  {
+    if (!m_pipeline_running.exchange(false)) {
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lk(m_pipeline_mutex);
+      m_pipeline_not_empty.notify_all();
+      m_pipeline_not_full.notify_all();
+    }
+    if (m_pipeline_reader.joinable()) {
+      m_pipeline_reader.join();
+    }
+    for (auto& worker : m_pipeline_workers) {
+      if (worker.joinable()) {
+        worker.join();
+      }
+    }
+    m_pipeline_workers.clear();
+  }
+
   std::atomic<bool> m_with_callback{ false };
   std::function<void(Datatype&)> m_callback;
-  std::unique_ptr<std::thread> m_event_loop_runner;
+  CallbackDispatcher::handle_t m_callback_handle{ 0 };
   std::shared_ptr<ipm::Receiver> m_network_receiver_ptr{ nullptr };
   std::shared_ptr<ipm::Subscriber> m_network_subscriber_ptr{ nullptr };
+
+  /// Stripe receivers of a striped connection (empty for plain ones);
+  /// the sweep position is guarded by m_receive_mutex like the sockets
+  std::vector<std::shared_ptr<ipm::Receiver>> m_stripe_receivers;
+  size_t m_next_stripe{ 0 };
+
+  /// Set instead of m_network_subscriber_ptr when this receiver's topic
+  /// is served by the connection's shared TopicDemux (see TopicDemux.hpp)
+  std::shared_ptr<TopicDemux> m_demux{ nullptr };
+  std::shared_ptr<TopicDemux::topic_queue_t> m_demux_queue{ nullptr };
+
   std::mutex m_callback_mutex;
   std::mutex m_receive_mutex;
+
+  /// Messages from a coalesced frame not yet handed out; guarded by
+  /// m_receive_mutex
+  std::deque<decltype(ipm::Receiver::Response::data)> m_pending_messages;
+
+  /// Partially reassembled chunked transfers by transfer id; guarded by
+  /// m_receive_mutex
+  static constexpr size_t s_max_reassembly = 8;
+  std::map<uint32_t, decltype(ipm::Receiver::Response::data)> m_reassembly;
+
+  // Pipelined receive engine state (only active when a deserializer pool
+  // is configured)
+  static constexpr size_t s_pipeline_capacity = 1024;
+  std::atomic<bool> m_pipeline_running{ false };
+  std::thread m_pipeline_reader;
+  std::vector<std::thread> m_pipeline_workers;
+  std::deque<ipm::Receiver::Response> m_pipeline_buffer;
+  std::mutex m_pipeline_mutex;
+  std::condition_variable m_pipeline_not_full;
+  std::condition_variable m_pipeline_not_empty;
 };
 
 } // namespace iomanager
@@ -11,17 +11,33 @@
 
 #include "iomanager/CommonIssues.hpp"
 #include "iomanager/ConnectionId.hpp"
+#include "iomanager/MessageFraming.hpp"
 #include "iomanager/QueueRegistry.hpp"
+#include "iomanager/TopicDemux.hpp"
+#include "iomanager/connectioninfo/InfoNljs.hpp"
 
 #include "ipm/Sender.hpp"
 #include "logging/Logging.hpp"
 #include "networkmanager/NetworkManager.hpp"
 #include "serialization/Serialization.hpp"
 
+#include "msgpack.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <random>
 #include <string>
+#include <thread>
+#include <type_traits>
 #include <typeinfo>
 #include <utility>
+#include <vector>
 
 namespace dunedaq {
 
@@ -45,9 +61,28 @@ public:
   ConnectionId const conn_id() const { return m_conn_id; }
   ConnectionRef const conn_ref() const { return m_conn_ref; }
 
+  /**
+   * @brief Method to retrieve hot-path counters from this connection for
+   * operational monitoring
+   */
+  void get_info(opmonlib::InfoCollector& ci, int /*level*/)
+  {
+    connectioninfo::SenderInfo info;
+    info.sent_messages = m_sent_messages.load(std::memory_order_relaxed);
+    info.sent_bytes = m_sent_bytes.load(std::memory_order_relaxed);
+    info.send_timeouts = m_send_timeouts.load(std::memory_order_relaxed);
+    ci.add(info);
+  }
+
 protected:
   ConnectionId m_conn_id;
   ConnectionRef m_conn_ref;
+
+  // Hot-path counters; only ever incremented with relaxed atomics so the
+  // bookkeeping stays cheap
+  std::atomic<uint64_t> m_sent_messages{ 0 };
+  std::atomic<uint64_t> m_sent_bytes{ 0 };
+  std::atomic<uint64_t> m_send_timeouts{ 0 };
 };
 
 // Interface
@@ -58,8 +93,115 @@ public:
   explicit SenderConcept(ConnectionId conn_id, ConnectionRef conn_ref)
     : Sender(conn_id, conn_ref)
   {}
+  virtual ~SenderConcept() { stop_flush_thread(); }
   virtual void send(Datatype&& data, Sender::timeout_t timeout, Topic_t topic = "") = 0;
   virtual bool try_send(Datatype&& data, Sender::timeout_t timeout, Topic_t topic = "") = 0;
+
+  /**
+   * Send a whole batch of messages in one call. Implementations pay the
+   * per-send overhead (virtual dispatch, locking, syscalls) once per batch
+   * instead of once per message.
+   */
+  virtual void send_batch(std::vector<Datatype>&& data, Sender::timeout_t timeout, Topic_t topic = "") = 0;
+
+  /**
+   * Hand the message to this sender's flush thread and return immediately,
+   * so serialization and the socket write overlap the caller's next
+   * iteration. The future completes when the underlying send() has
+   * finished and carries its exception if it failed. Submissions are
+   * flushed in order; if the bounded submission queue is full, send_async
+   * blocks until the flush thread has caught up.
+   */
+  std::future<void> send_async(Datatype&& data, Sender::timeout_t timeout, Topic_t topic = "")
+  {
+    Submission sub;
+    sub.data = std::move(data);
+    sub.timeout = timeout;
+    sub.topic = topic;
+    auto completion = sub.completion.get_future();
+
+    // The flush thread only exists once someone actually uses the async path
+    if (!m_flush_running.load()) {
+      std::lock_guard<std::mutex> lk(m_submission_mutex);
+      if (!m_flush_running.load()) {
+        m_flush_running = true;
+        m_flush_thread = std::thread(&SenderConcept::flush_loop, this);
+      }
+    }
+
+    {
+      std::unique_lock<std::mutex> lk(m_submission_mutex);
+      m_submission_not_full.wait(lk,
+                                 [&]() { return m_submissions.size() < s_submission_capacity || !m_flush_running.load(); });
+      m_submissions.push_back(std::move(sub));
+      m_submission_not_empty.notify_one();
+    }
+    return completion;
+  }
+
+protected:
+  /**
+   * Stop the flush thread after it has drained all pending submissions.
+   * Derived destructors call this before tearing down their own send
+   * machinery so the flush thread never runs against a partially-destroyed
+   * object.
+   */
+  void stop_flush_thread()
+  {
+    if (!m_flush_running.exchange(false)) {
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lk(m_submission_mutex);
+      m_submission_not_empty.notify_all();
+      m_submission_not_full.notify_all();
+    }
+    if (m_flush_thread.joinable()) {
+      m_flush_thread.join();
+    }
+  }
+
+private:
+  struct Submission
+  {
+    Datatype data; // Datatype must be default-constructible, which queue
+                   // datatypes already have to be for the receive path
+    Sender::timeout_t timeout{ Sender::s_no_block };
+    Topic_t topic;
+    std::promise<void> completion;
+  };
+
+  void flush_loop()
+  {
+    while (true) {
+      Submission sub;
+      {
+        std::unique_lock<std::mutex> lk(m_submission_mutex);
+        m_submission_not_empty.wait(lk, [&]() { return !m_submissions.empty() || !m_flush_running.load(); });
+        if (m_submissions.empty()) {
+          // shut down, and all pending submissions have been flushed
+          return;
+        }
+        sub = std::move(m_submissions.front());
+        m_submissions.pop_front();
+        m_submission_not_full.notify_one();
+      }
+      try {
+        send(std::move(sub.data), sub.timeout, sub.topic);
+        sub.completion.set_value();
+      } catch (...) { // NOLINT: failures are reported through the future
+        sub.completion.set_exception(std::current_exception());
+      }
+    }
+  }
+
+  static constexpr size_t s_submission_capacity = 1024;
+  std::deque<Submission> m_submissions;
+  std::mutex m_submission_mutex;
+  std::condition_variable m_submission_not_full;
+  std::condition_variable m_submission_not_empty;
+  std::thread m_flush_thread;
+  std::atomic<bool> m_flush_running{ false };
 };
 
 // QImpl
@@ -81,6 +223,8 @@ public:
     , m_queue(other.m_queue)
   {}
 
+  ~QueueSenderModel() { this->stop_flush_thread(); }
+
   void send(Datatype&& data, Sender::timeout_t timeout, Topic_t topic = "") override
   {
     if (topic != "") {
@@ -93,8 +237,10 @@ public:
     try {
       m_queue->push(std::move(data), timeout);
     } catch (QueueTimeoutExpired& ex) {
+      this->m_send_timeouts.fetch_add(1, std::memory_order_relaxed);
       throw TimeoutExpired(ERS_HERE, this->conn_id().uid, "push", timeout.count(), ex);
     }
+    this->m_sent_messages.fetch_add(1, std::memory_order_relaxed);
   }
 
   bool try_send(Datatype&& data, Sender::timeout_t timeout, Topic_t topic = "") override
@@ -108,7 +254,32 @@ public:
       return false;
     }
 
-    return m_queue->try_push(std::move(data), timeout);
+    auto successful = m_queue->try_push(std::move(data), timeout);
+    if (successful) {
+      this->m_sent_messages.fetch_add(1, std::memory_order_relaxed);
+    } else {
+      this->m_send_timeouts.fetch_add(1, std::memory_order_relaxed);
+    }
+    return successful;
+  }
+
+  void send_batch(std::vector<Datatype>&& data, Sender::timeout_t timeout, Topic_t topic = "") override
+  {
+    if (topic != "") {
+      TLOG() << "Topics are invalid for queues! Check config!";
+    }
+
+    if (m_queue == nullptr)
+      throw ConnectionInstanceNotFound(ERS_HERE, this->conn_id().uid);
+
+    auto batch_size = data.size();
+    try {
+      m_queue->push_bulk(std::move(data), timeout);
+    } catch (QueueTimeoutExpired& ex) {
+      this->m_send_timeouts.fetch_add(1, std::memory_order_relaxed);
+      throw TimeoutExpired(ERS_HERE, this->conn_id().uid, "push", timeout.count(), ex);
+    }
+    this->m_sent_messages.fetch_add(batch_size, std::memory_order_relaxed);
   }
 
 private:
@@ -127,19 +298,57 @@ public:
   {
     TLOG() << "NetworkSenderModel created with DT! Addr: " << static_cast<void*>(this);
     // get network resources
-    m_network_sender_ptr = networkmanager::NetworkManager::get().get_sender(conn_id.uid);
+    auto endpoints = endpoints_of_uri(conn_id.uri);
+    if (endpoints.size() > 1) {
+      // Striped connection: one ipm sender (and lock) per endpoint, see
+      // write_striped
+      for (size_t idx = 0; idx < endpoints.size(); ++idx) {
+        auto stripe = std::make_unique<Stripe>();
+        stripe->sender = networkmanager::NetworkManager::get().get_sender(conn_id.uid + "#" + std::to_string(idx));
+        m_stripes.push_back(std::move(stripe));
+      }
+    } else {
+      m_network_sender_ptr = networkmanager::NetworkManager::get().get_sender(conn_id.uid);
+    }
+    init_coalescing();
+    init_chunking();
+    init_serialization();
   }
 
   NetworkSenderModel(NetworkSenderModel&& other)
     : SenderConcept<Datatype>(other.m_conn_id, other.m_conn_ref)
     , m_network_sender_ptr(other.m_network_sender_ptr)
-  {}
+    , m_stripes(std::move(other.m_stripes))
+  {
+    init_coalescing();
+    init_chunking();
+    init_serialization();
+  }
+
+  ~NetworkSenderModel()
+  {
+    this->stop_flush_thread();
+    if (m_flusher_running.exchange(false)) {
+      {
+        std::lock_guard<std::mutex> lk(m_flusher_mutex);
+        m_flusher_cv.notify_all();
+      }
+      if (m_flusher.joinable()) {
+        m_flusher.join();
+      }
+    }
+    // Don't leave accumulated messages behind (and don't let a send
+    // failure throw out of the destructor)
+    std::lock_guard<std::mutex> lk(m_send_mutex);
+    try_flush_aggregate();
+  }
 
   void send(Datatype&& data, Sender::timeout_t timeout, Topic_t topic = "") override
   {
     try {
       write_network<Datatype>(data, timeout, topic);
     } catch (ipm::SendTimeoutExpired& ex) {
+      this->m_send_timeouts.fetch_add(1, std::memory_order_relaxed);
       throw TimeoutExpired(ERS_HERE, this->conn_id().uid, "send", timeout.count(), ex);
     }
   }
@@ -149,19 +358,50 @@ public:
     return try_write_network<Datatype>(data, timeout, topic);
   }
 
+  void send_batch(std::vector<Datatype>&& data, Sender::timeout_t timeout, Topic_t topic = "") override
+  {
+    try {
+      write_network_batch<Datatype>(data, timeout, topic);
+    } catch (ipm::SendTimeoutExpired& ex) {
+      this->m_send_timeouts.fetch_add(1, std::memory_order_relaxed);
+      throw TimeoutExpired(ERS_HERE, this->conn_id().uid, "send", timeout.count(), ex);
+    }
+  }
+
 private:
   template<typename MessageType>
   typename std::enable_if<dunedaq::serialization::is_serializable<MessageType>::value, void>::type
   write_network(MessageType& message, Sender::timeout_t const& timeout, std::string const& topic = "")
   {
+    if (!m_stripes.empty()) {
+      write_striped(message, timeout, topic);
+      return;
+    }
     if (m_network_sender_ptr == nullptr)
       throw ConnectionInstanceNotFound(ERS_HERE, this->conn_id().uid);
 
-    auto serialized = dunedaq::serialization::serialize(message, dunedaq::serialization::kMsgPack);
-    // TLOG() << "Serialized message for network sending: " << serialized.size() << ", this=" << (void*)this;
     std::lock_guard<std::mutex> lk(m_send_mutex);
 
-    m_network_sender_ptr->send(serialized.data(), serialized.size(), timeout, topic);
+    if (m_chunk_bytes > 0 && !m_raw_serialization) {
+      if (write_network_chunked(message, timeout, topic)) {
+        this->m_sent_messages.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+      // The whole message fit in one chunk and is now in m_send_buffer;
+      // fall through to the plain path so small messages stay unframed
+    } else {
+      serialize_into_send_buffer(message);
+    }
+    maybe_wrap_topic(topic);
+
+    if (m_coalesce_bytes > 0) {
+      append_to_aggregate(timeout, topic);
+      return;
+    }
+
+    m_network_sender_ptr->send(m_send_buffer.data(), m_send_buffer.size(), timeout, topic);
+    this->m_sent_messages.fetch_add(1, std::memory_order_relaxed);
+    this->m_sent_bytes.fetch_add(m_send_buffer.size(), std::memory_order_relaxed);
   }
 
   template<typename MessageType>
@@ -171,20 +411,94 @@ private:
     throw NetworkMessageNotSerializable(ERS_HERE, typeid(MessageType).name());
   }
 
+  template<typename MessageType>
+  typename std::enable_if<dunedaq::serialization::is_serializable<MessageType>::value, void>::type
+  write_network_batch(std::vector<MessageType>& messages, Sender::timeout_t const& timeout, std::string const& topic = "")
+  {
+    if (!m_stripes.empty()) {
+      for (auto& message : messages) {
+        write_striped(message, timeout, topic);
+      }
+      return;
+    }
+    if (m_network_sender_ptr == nullptr)
+      throw ConnectionInstanceNotFound(ERS_HERE, this->conn_id().uid);
+
+    // Take the lock once for the whole batch
+    std::lock_guard<std::mutex> lk(m_send_mutex);
+
+    for (auto& message : messages) {
+      if (m_chunk_bytes > 0 && !m_raw_serialization) {
+        if (write_network_chunked(message, timeout, topic)) {
+          this->m_sent_messages.fetch_add(1, std::memory_order_relaxed);
+          continue;
+        }
+      } else {
+        serialize_into_send_buffer(message);
+      }
+      maybe_wrap_topic(topic);
+      if (m_coalesce_bytes > 0) {
+        append_to_aggregate(timeout, topic);
+        continue;
+      }
+      m_network_sender_ptr->send(m_send_buffer.data(), m_send_buffer.size(), timeout, topic);
+      this->m_sent_messages.fetch_add(1, std::memory_order_relaxed);
+      this->m_sent_bytes.fetch_add(m_send_buffer.size(), std::memory_order_relaxed);
+    }
+  }
+
+  template<typename MessageType>
+  typename std::enable_if<!dunedaq::serialization::is_serializable<MessageType>::value, void>::type
+  write_network_batch(std::vector<MessageType>&, Sender::timeout_t const&, std::string const&)
+  {
+    throw NetworkMessageNotSerializable(ERS_HERE, typeid(MessageType).name());
+  }
+
   template<typename MessageType>
   typename std::enable_if<dunedaq::serialization::is_serializable<MessageType>::value, bool>::type
       try_write_network(MessageType& message, Sender::timeout_t const& timeout, std::string const& topic = "")
   {
+    if (!m_stripes.empty()) {
+      return write_striped(message, timeout, topic, true);
+    }
     if (m_network_sender_ptr == nullptr) {
       ers::error(ConnectionInstanceNotFound(ERS_HERE, this->conn_id().uid));
       return false;
     }
 
-    auto serialized = dunedaq::serialization::serialize(message, dunedaq::serialization::kMsgPack);
-    // TLOG() << "Serialized message for network sending: " << serialized.size() << ", this=" << (void*)this;
     std::lock_guard<std::mutex> lk(m_send_mutex);
 
-    return m_network_sender_ptr->send(serialized.data(), serialized.size(), timeout, topic, true);
+    if (m_chunk_bytes > 0 && !m_raw_serialization) {
+      try {
+        if (write_network_chunked(message, timeout, topic)) {
+          this->m_sent_messages.fetch_add(1, std::memory_order_relaxed);
+          return true;
+        }
+      } catch (ipm::SendTimeoutExpired&) {
+        // A chunk timed out mid-transfer; the receiver discards the
+        // partial transfer when the id is reused or evicted
+        this->m_send_timeouts.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+    } else {
+      serialize_into_send_buffer(message);
+    }
+    maybe_wrap_topic(topic);
+
+    if (m_coalesce_bytes > 0) {
+      // Appending to the aggregate never blocks on the socket
+      append_to_aggregate(timeout, topic);
+      return true;
+    }
+
+    auto successful = m_network_sender_ptr->send(m_send_buffer.data(), m_send_buffer.size(), timeout, topic, true);
+    if (successful) {
+      this->m_sent_messages.fetch_add(1, std::memory_order_relaxed);
+      this->m_sent_bytes.fetch_add(m_send_buffer.size(), std::memory_order_relaxed);
+    } else {
+      this->m_send_timeouts.fetch_add(1, std::memory_order_relaxed);
+    }
+    return successful;
   }
 
   template<typename MessageType>
@@ -195,8 +509,363 @@ private:
     return false;
   }
 
+  /**
+   * Serialize message into m_send_buffer, reusing the buffer's allocation
+   * from previous sends so the steady-state send path performs no heap
+   * allocations. msgpack::pack produces the same bytes that
+   * serialization::serialize(message, kMsgPack) would, so the wire format
+   * is unchanged. Must be called with m_send_mutex held.
+   */
+  template<typename MessageType>
+  void serialize_into_send_buffer(MessageType& message)
+  {
+    serialize_into(m_send_buffer, message);
+    // TLOG() << "Serialized message for network sending: " << m_send_buffer.size() << ", this=" << (void*)this;
+  }
+
+  /// Serialization core shared by the single-socket and striped send
+  /// paths; the caller must hold the lock guarding buffer
+  template<typename MessageType>
+  void serialize_into(msgpack::sbuffer& buffer, MessageType& message)
+  {
+    buffer.clear();
+    if constexpr (std::is_trivially_copyable_v<MessageType>) {
+      if (m_raw_serialization) {
+        // Raw format: a four-byte frame header followed by the object
+        // bytes, no encoder in the path (see MessageFraming.hpp)
+        static const char header[framing::s_raw_header_size] = { static_cast<char>(framing::s_frame_marker),
+                                                                 framing::s_raw_tag,
+                                                                 0,
+                                                                 0 };
+        buffer.write(header, sizeof(header));
+        buffer.write(reinterpret_cast<const char*>(&message), sizeof(MessageType)); // NOLINT
+        return;
+      }
+    }
+    msgpack::pack(buffer, message);
+  }
+
+  /**
+   * Send one message over a striped connection. Messages round-robin
+   * across the stripes and each stripe has its own ipm sender, lock and
+   * serialization buffer, so concurrent producers on one logical
+   * connection scale across sockets instead of serializing on a single
+   * m_send_mutex. Per-stripe ordering is preserved; ordering across
+   * stripes is not. Striped sends bypass the coalescing, chunking and
+   * topic-framing machinery, whose shared state is what striping exists
+   * to avoid.
+   */
+  template<typename MessageType>
+  bool write_striped(MessageType& message, Sender::timeout_t const& timeout, std::string const& topic, bool no_tmoexcept = false)
+  {
+    auto& stripe = *m_stripes[m_next_stripe.fetch_add(1, std::memory_order_relaxed) % m_stripes.size()];
+    std::lock_guard<std::mutex> lk(stripe.mutex);
+    serialize_into(stripe.buffer, message);
+    auto successful = stripe.sender->send(stripe.buffer.data(), stripe.buffer.size(), timeout, topic, no_tmoexcept);
+    if (successful) {
+      this->m_sent_messages.fetch_add(1, std::memory_order_relaxed);
+      this->m_sent_bytes.fetch_add(stripe.buffer.size(), std::memory_order_relaxed);
+    } else {
+      this->m_send_timeouts.fetch_add(1, std::memory_order_relaxed);
+    }
+    return successful;
+  }
+
+  /**
+   * Raw serialization mode: connections configured with
+   * SerializationFormat::kRaw skip the msgpack encoder and memcpy
+   * trivially-copyable Datatypes straight into the send buffer, framed so
+   * that NetworkReceiverModel can tell raw payloads from encoded ones.
+   * The selection is made at compile time on the Datatype; requesting raw
+   * for a type that is not trivially copyable falls back to msgpack with
+   * a warning rather than shipping non-portable bytes.
+   */
+  void init_serialization()
+  {
+    if (this->conn_id().serialization != SerializationFormat::kRaw) {
+      return;
+    }
+    if constexpr (std::is_trivially_copyable_v<Datatype>) {
+      m_raw_serialization = true;
+    } else {
+      ers::warning(RawFormatUnavailable(ERS_HERE, this->conn_id().uid, typeid(Datatype).name()));
+    }
+  }
+
+  /**
+   * Rewrite m_send_buffer as a topic frame (see MessageFraming.hpp and
+   * TopicDemux.hpp) when topic demultiplexing is enabled and the message
+   * is being published on a topic. Runs before coalescing so that every
+   * message inside an aggregate carries its own topic. Receivers strip
+   * the frame whether or not they demux, so the mode only has to be
+   * enabled consistently per connection (like coalescing). Must be called
+   * with m_send_mutex held.
+   */
+  void maybe_wrap_topic(std::string const& topic)
+  {
+    if (!m_topic_framing || topic.empty()) {
+      return;
+    }
+    framing::start_topic_frame(m_topic_scratch, topic);
+    m_topic_scratch.insert(m_topic_scratch.end(), m_send_buffer.data(), m_send_buffer.data() + m_send_buffer.size());
+    m_send_buffer.clear();
+    m_send_buffer.write(m_topic_scratch.data(), m_topic_scratch.size());
+  }
+
+  /**
+   * msgpack output stream that ships completed chunks while serialization
+   * of the rest of the message is still running: whenever the chunk
+   * buffer reaches m_chunk_bytes, a chunk frame goes out on the wire and
+   * the buffer is reused for the next chunk. Sender-side buffering is
+   * thus bounded by the chunk size regardless of message size, and the
+   * wire transfer of early chunks overlaps serialization of later ones.
+   */
+  class ChunkWriter
+  {
+  public:
+    ChunkWriter(NetworkSenderModel& parent, Sender::timeout_t const& timeout, std::string const& topic)
+      : m_parent(parent)
+      , m_timeout(timeout)
+      , m_topic(topic)
+      , m_transfer_id(parent.m_next_transfer_id++)
+    {
+      m_parent.m_chunk_buffer.clear();
+      m_parent.m_chunk_buffer.resize(framing::s_chunk_header_size);
+    }
+
+    /// Called by msgpack::pack with successive spans of serialized bytes
+    void write(const char* data, size_t size)
+    {
+      auto& buffer = m_parent.m_chunk_buffer;
+      while (size > 0) {
+        auto room = framing::s_chunk_header_size + m_parent.m_chunk_bytes - buffer.size();
+        if (room == 0) {
+          emit_chunk(false);
+          room = m_parent.m_chunk_bytes;
+        }
+        auto take = size < room ? size : room;
+        buffer.insert(buffer.end(), data, data + take);
+        data += take;
+        size -= take;
+      }
+    }
+
+    /**
+     * Finish the transfer. Returns true if the message went out as chunk
+     * frames; returns false if the whole message fit into the first
+     * chunk, in which case nothing was sent and the serialized bytes have
+     * been copied into the parent's m_send_buffer for the plain path.
+     */
+    bool finish()
+    {
+      if (m_chunks_sent == 0) {
+        auto& buffer = m_parent.m_chunk_buffer;
+        m_parent.m_send_buffer.clear();
+        m_parent.m_send_buffer.write(buffer.data() + framing::s_chunk_header_size,
+                                     buffer.size() - framing::s_chunk_header_size);
+        return false;
+      }
+      emit_chunk(true);
+      return true;
+    }
+
+  private:
+    void emit_chunk(bool last)
+    {
+      auto& buffer = m_parent.m_chunk_buffer;
+      framing::write_chunk_header(buffer, m_transfer_id, m_chunks_sent++, last);
+      m_parent.m_network_sender_ptr->send(buffer.data(), buffer.size(), m_timeout, m_topic);
+      m_parent.m_sent_bytes.fetch_add(buffer.size(), std::memory_order_relaxed);
+      buffer.resize(framing::s_chunk_header_size);
+    }
+
+    NetworkSenderModel& m_parent;
+    Sender::timeout_t m_timeout;
+    std::string m_topic;
+    uint32_t m_transfer_id;
+    uint32_t m_chunks_sent{ 0 };
+  };
+
+  /**
+   * Serialize message straight into chunk frames (see ChunkWriter). Must
+   * be called with m_send_mutex held. Returns false when the message was
+   * small enough for a single chunk; the caller then sends it through the
+   * plain (and possibly coalescing) path from m_send_buffer.
+   */
+  template<typename MessageType>
+  bool write_network_chunked(MessageType& message, Sender::timeout_t const& timeout, std::string const& topic)
+  {
+    ChunkWriter writer(*this, timeout, topic);
+    msgpack::pack(writer, message);
+    return writer.finish();
+  }
+
+  /**
+   * Chunked streaming mode: when IOMANAGER_CHUNK_BYTES is set to a
+   * nonzero payload size, messages whose serialized form exceeds one
+   * chunk are streamed as a sequence of bounded chunk frames that
+   * NetworkReceiverModel reassembles transparently. A 200 MB trigger
+   * record then costs one chunk buffer of memory on the sender instead of
+   * a 200 MB allocation, and its wire transfer overlaps serialization.
+   * Messages that fit in one chunk are sent unframed as before, so the
+   * mode only needs to be enabled where large messages actually flow.
+   */
+  void init_chunking()
+  {
+    char* env = getenv("IOMANAGER_CHUNK_BYTES"); // NOLINT(concurrency-mt-unsafe)
+    if (env == nullptr) {
+      return;
+    }
+    m_chunk_bytes = strtoul(env, nullptr, 0); // NOLINT(runtime/threadsafe_fn)
+  }
+
+  /**
+   * Coalescing mode: instead of paying one ipm send (and its syscall) per
+   * message, serialized messages are length-prefixed into an aggregate
+   * frame that is flushed when it reaches IOMANAGER_COALESCE_BYTES bytes
+   * or when the oldest pending message is IOMANAGER_COALESCE_USEC old
+   * (default 100 us), whichever comes first. NetworkReceiverModel splits
+   * the frames back apart, so the mode is transparent to consumers as
+   * long as both ends run it.
+   */
+  void init_coalescing()
+  {
+    char* env = getenv("IOMANAGER_COALESCE_BYTES"); // NOLINT(concurrency-mt-unsafe)
+    if (env == nullptr) {
+      return;
+    }
+    m_coalesce_bytes = strtoul(env, nullptr, 0); // NOLINT(runtime/threadsafe_fn)
+    if (m_coalesce_bytes == 0) {
+      return;
+    }
+    env = getenv("IOMANAGER_COALESCE_USEC"); // NOLINT(concurrency-mt-unsafe)
+    if (env != nullptr) {
+      m_coalesce_deadline = std::chrono::microseconds(strtoul(env, nullptr, 0)); // NOLINT(runtime/threadsafe_fn)
+    }
+
+    m_flusher_running = true;
+    m_flusher = std::thread([this]() {
+      while (m_flusher_running.load()) {
+        {
+          std::unique_lock<std::mutex> lk(m_flusher_mutex);
+          m_flusher_cv.wait_for(lk, m_coalesce_deadline, [&]() { return !m_flusher_running.load(); });
+        }
+        if (!m_flusher_running.load()) {
+          break;
+        }
+        std::lock_guard<std::mutex> lk(m_send_mutex);
+        if (m_aggregate_count > 0 && std::chrono::steady_clock::now() - m_aggregate_start >= m_coalesce_deadline) {
+          try_flush_aggregate();
+        }
+      }
+    });
+  }
+
+  /**
+   * Append the contents of m_send_buffer to the aggregate frame, flushing
+   * first on a topic change and afterwards when the size threshold is hit.
+   * Must be called with m_send_mutex held.
+   */
+  void append_to_aggregate(Sender::timeout_t const& timeout, std::string const& topic)
+  {
+    if (m_aggregate_count > 0 && topic != m_aggregate_topic) {
+      flush_aggregate();
+    }
+    if (m_aggregate_count == 0) {
+      framing::start_coalesced_frame(m_aggregate_buffer);
+      m_aggregate_topic = topic;
+      m_aggregate_start = std::chrono::steady_clock::now();
+    }
+    framing::append_coalesced_message(m_aggregate_buffer, m_send_buffer.data(), m_send_buffer.size());
+    ++m_aggregate_count;
+    m_aggregate_timeout = timeout;
+
+    if (m_aggregate_buffer.size() >= m_coalesce_bytes) {
+      flush_aggregate();
+    }
+  }
+
+  /// Send the aggregate frame. Must be called with m_send_mutex held.
+  void flush_aggregate()
+  {
+    if (m_aggregate_count == 0) {
+      return;
+    }
+    framing::patch_coalesced_count(m_aggregate_buffer, m_aggregate_count);
+    m_network_sender_ptr->send(m_aggregate_buffer.data(), m_aggregate_buffer.size(), m_aggregate_timeout,
+                               m_aggregate_topic);
+    this->m_sent_messages.fetch_add(m_aggregate_count, std::memory_order_relaxed);
+    this->m_sent_bytes.fetch_add(m_aggregate_buffer.size(), std::memory_order_relaxed);
+    m_aggregate_buffer.clear();
+    m_aggregate_count = 0;
+  }
+
+  /**
+   * flush_aggregate() for contexts where an exception must not escape:
+   * the deadline flusher thread (where it would std::terminate the
+   * process) and the destructor. m_aggregate_timeout is whatever the last
+   * append passed, possibly zero, so send timeouts here are a normal
+   * backpressure signal: the aggregate is kept so a later append or
+   * deadline tick retries the flush. Must be called with m_send_mutex
+   * held.
+   */
+  void try_flush_aggregate()
+  {
+    try {
+      flush_aggregate();
+    } catch (ipm::SendTimeoutExpired& ex) {
+      this->m_send_timeouts.fetch_add(1, std::memory_order_relaxed);
+      ers::warning(TimeoutExpired(ERS_HERE, this->conn_id().uid, "flush aggregate", m_aggregate_timeout.count(), ex));
+    } catch (ers::Issue& ex) {
+      // Not a timeout, so retrying is unlikely to help; drop the aggregate
+      ers::warning(ex);
+      m_aggregate_buffer.clear();
+      m_aggregate_count = 0;
+    }
+  }
+
   std::shared_ptr<ipm::Sender> m_network_sender_ptr;
+
+  /// One stripe of a striped connection, see write_striped
+  struct Stripe
+  {
+    std::shared_ptr<ipm::Sender> sender;
+    std::mutex mutex;
+    msgpack::sbuffer buffer; ///< Reused across sends; guarded by mutex
+  };
+  std::vector<std::unique_ptr<Stripe>> m_stripes; ///< Empty for plain connections
+  std::atomic<size_t> m_next_stripe{ 0 };
+
   std::mutex m_send_mutex;
+  msgpack::sbuffer m_send_buffer; ///< Reused across sends; guarded by m_send_mutex
+
+  bool m_raw_serialization{ false }; ///< See init_serialization
+
+  // Topic framing state, see maybe_wrap_topic. Sampled at construction
+  // like the other tuning knobs.
+  bool m_topic_framing{ TopicDemux::enabled() };
+  std::vector<char> m_topic_scratch; ///< Reused by maybe_wrap_topic; guarded by m_send_mutex
+
+  // Chunked streaming state, guarded by m_send_mutex. Transfer ids start
+  // from a random value so that transfers from different senders arriving
+  // on one receiving socket do not collide in its reassembly map.
+  size_t m_chunk_bytes{ 0 }; ///< 0 disables chunking
+  std::vector<char> m_chunk_buffer;
+  uint32_t m_next_transfer_id{ static_cast<uint32_t>(std::random_device{}()) };
+
+  // Coalescing state, all guarded by m_send_mutex except the flusher
+  // thread's own coordination members
+  size_t m_coalesce_bytes{ 0 }; ///< 0 disables coalescing
+  std::chrono::microseconds m_coalesce_deadline{ 100 };
+  std::vector<char> m_aggregate_buffer;
+  uint32_t m_aggregate_count{ 0 };
+  std::string m_aggregate_topic;
+  Sender::timeout_t m_aggregate_timeout{ Sender::s_no_block };
+  std::chrono::steady_clock::time_point m_aggregate_start;
+  std::atomic<bool> m_flusher_running{ false };
+  std::thread m_flusher;
+  std::mutex m_flusher_mutex;
+  std::condition_variable m_flusher_cv;
 };
 
 } // namespace iomanager
@@ -5,7 +5,9 @@
  *
  * @file StdDeQueue.hpp
  *
- * A std::deque-based implementation of Queue
+ * A mutex-based implementation of Queue, backed by a preallocated ring
+ * buffer. (The class keeps its historical name from the days when the
+ * backing store was a std::deque.)
  *
  * This is part of the DUNE DAQ Application Framework, copyright 2020.
  * Licensing/copyright details are in the COPYING file that you should have
@@ -18,7 +20,6 @@
 #include <cassert>
 #include <chrono>
 #include <condition_variable>
-#include <deque>
 #include <functional>
 #include <iostream>
 #include <mutex>
@@ -27,12 +28,17 @@
 #include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace dunedaq {
 namespace iomanager {
 /**
- * @brief A Queue Implementation that uses a std::deque as its backend
- * @tparam T Data Type to be stored in the std::deque
+ * @brief A Queue Implementation that uses a preallocated ring buffer as
+ * its backend. All slots are allocated up front in one contiguous block,
+ * so pushes and pops never touch the allocator and walk memory linearly.
+ * @tparam T Data Type to be stored in the ring buffer; must be
+ * default-constructible (which Queue datatypes already have to be for the
+ * receive path)
  */
 template<class T>
 class StdDeQueue : public Queue<T>
@@ -50,10 +56,12 @@ public:
   bool can_pop() const noexcept override { return this->get_num_elements() > 0; }
   void pop(value_t& val, const duration_t&) override; // Throws QueueTimeoutExpired if a timeout occurs
   bool try_pop(value_t& val, const duration_t&) override;
+  size_t pop_bulk(std::vector<value_t>& vals, size_t max_n, const duration_t&) override;
 
   bool can_push() const noexcept override { return this->get_num_elements() < this->get_capacity(); }
   void push(value_t&&, const duration_t&) override; // Throws QueueTimeoutExpired if a timeout occurs
   bool try_push(value_t&&, const duration_t&) override;
+  void push_bulk(std::vector<value_t>&& vals, const duration_t&) override; // Throws QueueTimeoutExpired
 
   size_t get_capacity() const override { return m_capacity; }
 
@@ -70,7 +78,9 @@ public:
 private:
   void try_lock_for(std::unique_lock<std::mutex>&, const duration_t&);
 
-  std::deque<value_t> m_deque;
+  std::vector<value_t> m_ring;
+  size_t m_head = 0; ///< Index of the next element to pop
+  size_t m_tail = 0; ///< Index of the next free slot
   size_t m_capacity;
   std::atomic<size_t> m_size = 0;
 
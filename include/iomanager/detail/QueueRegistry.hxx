@@ -11,15 +11,25 @@ std::shared_ptr<Queue<T>>
 QueueRegistry::get_queue(const std::string& name)
 {
 
-  auto queue_it = m_queue_registry.find(name);
-  if (queue_it != m_queue_registry.end()) {
-    auto queuePtr = std::dynamic_pointer_cast<Queue<T>>(queue_it->second.m_instance);
+  // One hash probe resolves the interned index assigned at configure()
+  // time; everything else is array indexing
+  auto index_it = m_queue_index.find(name);
+  if (index_it == m_queue_index.end()) {
+    // TODO: John Freeman (jcfree@fnal.gov), Jun-23-2020. Add checks for demangling status. Timescale 2 weeks.
+    int status = -999;
+    std::string realname_target = abi::__cxa_demangle(typeid(T).name(), 0, 0, &status);
+    throw QueueNotFound(ERS_HERE, name, realname_target);
+  }
+
+  auto& entry = m_queue_registry[index_it->second];
+  if (entry.m_instance != nullptr) {
+    auto queuePtr = std::dynamic_pointer_cast<Queue<T>>(entry.m_instance);
 
     if (!queuePtr) {
       // TODO: John Freeman (jcfree@fnal.gov), Jun-23-2020. Add checks for demangling status. Timescale 2 weeks.
       int status = -999;
       std::string realname_target = abi::__cxa_demangle(typeid(T).name(), 0, 0, &status);
-      std::string realname_source = abi::__cxa_demangle(queue_it->second.m_type->name(), 0, 0, &status);
+      std::string realname_source = abi::__cxa_demangle(entry.m_type->name(), 0, 0, &status);
 
       throw QueueTypeMismatch(ERS_HERE, name, realname_source, realname_target);
     }
@@ -27,18 +37,8 @@ QueueRegistry::get_queue(const std::string& name)
     return queuePtr;
   }
 
-  auto config_it = this->m_queue_config_map.find(name);
-  if (config_it != m_queue_config_map.end()) {
-    QueueEntry entry = { &typeid(T), create_queue<T>(name, config_it->second) };
-    m_queue_registry[name] = entry;
-    return std::dynamic_pointer_cast<Queue<T>>(entry.m_instance);
-
-  } else {
-    // TODO: John Freeman (jcfree@fnal.gov), Jun-23-2020. Add checks for demangling status. Timescale 2 weeks.
-    int status = -999;
-    std::string realname_target = abi::__cxa_demangle(typeid(T).name(), 0, 0, &status);
-    throw QueueNotFound(ERS_HERE, name, realname_target);
-  }
+  entry = { &typeid(T), create_queue<T>(name, m_queue_configs[index_it->second]) };
+  return std::dynamic_pointer_cast<Queue<T>>(entry.m_instance);
 }
 
 template<typename T>
@@ -46,20 +46,50 @@ std::shared_ptr<QueueBase>
 QueueRegistry::create_queue(const std::string& name, const QueueConfig& config)
 {
 
+  // Bind the creating thread to the requested NUMA node while the queue
+  // storage is allocated, so first-touch places preallocated buffers
+  // (e.g. the StdDeQueue ring) on that node. The folly queues allocate
+  // their segments lazily, so for them this mainly places the control
+  // block; pin the producer and consumer threads to the same node for the
+  // full effect.
+  cpu_set_t previous_affinity;
+  bool bound = false;
+  if (config.numa_node >= 0) {
+    bound = bind_thread_to_numa_node(config.numa_node, previous_affinity);
+  }
+
   std::shared_ptr<QueueBase> queue;
-  switch (config.kind) {
-    case QueueConfig::kStdDeQueue:
-      queue = std::make_shared<StdDeQueue<T>>(name, config.capacity);
-      break;
-    case QueueConfig::kFollySPSCQueue:
-      queue = std::make_shared<FollySPSCQueue<T>>(name, config.capacity);
-      break;
-    case QueueConfig::kFollyMPMCQueue:
-      queue = std::make_shared<FollyMPMCQueue<T>>(name, config.capacity);
-      break;
-
-    default:
-      throw QueueKindUnknown(ERS_HERE, std::to_string(config.kind));
+  try {
+    switch (config.kind) {
+      case QueueConfig::kStdDeQueue:
+        queue = std::make_shared<StdDeQueue<T>>(name, config.capacity);
+        break;
+      case QueueConfig::kFollySPSCQueue:
+        queue = std::make_shared<FollySPSCQueue<T>>(name, config.capacity);
+        break;
+      case QueueConfig::kFollyMPMCQueue:
+        queue = std::make_shared<FollyMPMCQueue<T>>(name, config.capacity);
+        break;
+      case QueueConfig::kFollyMPSCQueue:
+        queue = std::make_shared<FollyMPSCQueue<T>>(name, config.capacity);
+        break;
+      case QueueConfig::kFollyUnboundedQueue:
+        queue = std::make_shared<FollyUnboundedQueue<T>>(name, config.capacity);
+        break;
+
+      default:
+        throw QueueKindUnknown(ERS_HERE, std::to_string(config.kind));
+    }
+  } catch (...) {
+    if (bound) {
+      restore_thread_affinity(previous_affinity);
+    }
+    throw;
+  }
+
+  if (bound) {
+    restore_thread_affinity(previous_affinity);
+    queue->set_numa_node(config.numa_node);
   }
 
   return queue;
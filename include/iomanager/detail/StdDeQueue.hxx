@@ -6,11 +6,11 @@ namespace dunedaq::iomanager {
 template<class T>
 StdDeQueue<T>::StdDeQueue(const std::string& name, size_t capacity)
   : Queue<T>(name)
-  , m_deque()
+  , m_ring(capacity) // all slots allocated up front
   , m_capacity(capacity)
   , m_size(0)
 {
-  assert(m_deque.max_size() > this->get_capacity());
+  assert(this->get_capacity() > 0);
 }
 
 template<class T>
@@ -18,6 +18,19 @@ void
 StdDeQueue<T>::push(value_t&& object_to_push, const duration_t& timeout)
 {
 
+  // An infinite timeout parks on the condition variable without any
+  // deadline arithmetic (which would overflow with duration_t::max())
+  if (timeout == duration_t::max()) {
+    std::unique_lock<std::mutex> lk(m_mutex);
+    m_no_longer_full.wait(lk, [&]() { return this->can_push(); });
+    m_ring[m_tail] = std::move(object_to_push);
+    m_tail = (m_tail + 1) % m_capacity;
+    m_size++;
+    m_no_longer_empty.notify_one();
+    this->note_push();
+    return;
+  }
+
   auto start_time = std::chrono::steady_clock::now();
   std::unique_lock<std::mutex> lk(m_mutex, std::defer_lock);
 
@@ -30,9 +43,11 @@ StdDeQueue<T>::push(value_t&& object_to_push, const duration_t& timeout)
   }
 
   if (this->can_push()) {
-    m_deque.push_back(std::move(object_to_push));
+    m_ring[m_tail] = std::move(object_to_push);
+    m_tail = (m_tail + 1) % m_capacity;
     m_size++;
     m_no_longer_empty.notify_one();
+    this->note_push();
   } else {
     throw QueueTimeoutExpired(
       ERS_HERE, this->get_name(), "push", std::chrono::duration_cast<std::chrono::milliseconds>(timeout).count());
@@ -44,6 +59,18 @@ void
 StdDeQueue<T>::pop(T& val, const duration_t& timeout)
 {
 
+  // See push(): infinite timeouts wait without a deadline
+  if (timeout == duration_t::max()) {
+    std::unique_lock<std::mutex> lk(m_mutex);
+    m_no_longer_empty.wait(lk, [&]() { return this->can_pop(); });
+    val = std::move(m_ring[m_head]);
+    m_head = (m_head + 1) % m_capacity;
+    m_size--;
+    m_no_longer_full.notify_one();
+    this->note_pop();
+    return;
+  }
+
   auto start_time = std::chrono::steady_clock::now();
   std::unique_lock<std::mutex> lk(m_mutex, std::defer_lock);
 
@@ -56,10 +83,11 @@ StdDeQueue<T>::pop(T& val, const duration_t& timeout)
   }
 
   if (this->can_pop()) {
-    val = std::move(m_deque.front());
+    val = std::move(m_ring[m_head]);
+    m_head = (m_head + 1) % m_capacity;
     m_size--;
-    m_deque.pop_front();
     m_no_longer_full.notify_one();
+    this->note_pop();
   } else {
     throw QueueTimeoutExpired(
       ERS_HERE, this->get_name(), "pop", std::chrono::duration_cast<std::chrono::milliseconds>(timeout).count());
@@ -83,13 +111,16 @@ StdDeQueue<T>::try_push(value_t&& object_to_push, const duration_t& timeout)
   }
 
   if (this->can_push()) {
-    m_deque.push_back(std::move(object_to_push));
+    m_ring[m_tail] = std::move(object_to_push);
+    m_tail = (m_tail + 1) % m_capacity;
     m_size++;
     m_no_longer_empty.notify_one();
+    this->note_push();
     return true;
   } else {
-    ers::error(QueueTimeoutExpired(
-      ERS_HERE, this->get_name(), "push", std::chrono::duration_cast<std::chrono::milliseconds>(timeout).count()));
+    // Counter plus rate-limited report; one ERS issue per failed push
+    // would melt down under a stalled consumer
+    this->note_push_timeout(std::chrono::duration_cast<std::chrono::milliseconds>(timeout).count());
     return false;
   }
 }
@@ -111,18 +142,113 @@ StdDeQueue<T>::try_pop(T& val, const duration_t& timeout)
   }
 
   if (this->can_pop()) {
-    val = std::move(m_deque.front());
+    val = std::move(m_ring[m_head]);
+    m_head = (m_head + 1) % m_capacity;
     m_size--;
-    m_deque.pop_front();
     m_no_longer_full.notify_one();
+    this->note_pop();
     return true;
   } else {
-    ers::error(QueueTimeoutExpired(
-      ERS_HERE, this->get_name(), "pop", std::chrono::duration_cast<std::chrono::milliseconds>(timeout).count()));
+    if (timeout.count() > 0) {
+      this->note_pop_timeout(std::chrono::duration_cast<std::chrono::milliseconds>(timeout).count());
+    }
     return false;
   }
 }
 
+template<class T>
+void
+StdDeQueue<T>::push_bulk(std::vector<value_t>&& vals, const duration_t& timeout)
+{
+  // One lock acquisition and one deadline for the whole batch, instead of
+  // the per-element locking and deadline arithmetic of the default
+  // implementation
+
+  // As in push(), an infinite timeout parks on the condition variable
+  // without any deadline arithmetic
+  if (timeout == duration_t::max()) {
+    std::unique_lock<std::mutex> lk(m_mutex);
+    for (auto& val : vals) {
+      m_no_longer_full.wait(lk, [&]() { return this->can_push(); });
+      m_ring[m_tail] = std::move(val);
+      m_tail = (m_tail + 1) % m_capacity;
+      m_size++;
+      m_no_longer_empty.notify_one();
+      this->note_push();
+    }
+    return;
+  }
+
+  auto start_time = std::chrono::steady_clock::now();
+  std::unique_lock<std::mutex> lk(m_mutex, std::defer_lock);
+
+  this->try_lock_for(lk, timeout);
+
+  for (auto& val : vals) {
+    auto time_to_wait_for_space = (start_time + timeout) - std::chrono::steady_clock::now();
+
+    if (time_to_wait_for_space.count() > 0) {
+      m_no_longer_full.wait_for(lk, time_to_wait_for_space, [&]() { return this->can_push(); });
+    }
+
+    if (!this->can_push()) {
+      throw QueueTimeoutExpired(
+        ERS_HERE, this->get_name(), "push", std::chrono::duration_cast<std::chrono::milliseconds>(timeout).count());
+    }
+    m_ring[m_tail] = std::move(val);
+    m_tail = (m_tail + 1) % m_capacity;
+    m_size++;
+    m_no_longer_empty.notify_one();
+    this->note_push();
+  }
+}
+
+template<class T>
+size_t
+StdDeQueue<T>::pop_bulk(std::vector<value_t>& vals, size_t max_n, const duration_t& timeout)
+{
+  vals.clear();
+  vals.reserve(max_n);
+
+  // See push_bulk: the lock is taken once for the whole batch. Only the
+  // first element is waited for; the rest of the batch is whatever is
+  // already in the ring.
+  if (timeout == duration_t::max()) {
+    std::unique_lock<std::mutex> lk(m_mutex);
+    m_no_longer_empty.wait(lk, [&]() { return this->can_pop(); });
+    while (vals.size() < max_n && this->can_pop()) {
+      vals.emplace_back(std::move(m_ring[m_head]));
+      m_head = (m_head + 1) % m_capacity;
+      m_size--;
+      this->note_pop();
+    }
+    m_no_longer_full.notify_all();
+    return vals.size();
+  }
+
+  auto start_time = std::chrono::steady_clock::now();
+  std::unique_lock<std::mutex> lk(m_mutex, std::defer_lock);
+
+  this->try_lock_for(lk, timeout);
+
+  auto time_to_wait_for_data = (start_time + timeout) - std::chrono::steady_clock::now();
+
+  if (time_to_wait_for_data.count() > 0) {
+    m_no_longer_empty.wait_for(lk, time_to_wait_for_data, [&]() { return this->can_pop(); });
+  }
+
+  while (vals.size() < max_n && this->can_pop()) {
+    vals.emplace_back(std::move(m_ring[m_head]));
+    m_head = (m_head + 1) % m_capacity;
+    m_size--;
+    this->note_pop();
+  }
+  if (!vals.empty()) {
+    m_no_longer_full.notify_all();
+  }
+  return vals.size();
+}
+
 // This try_lock_for() function was written because while objects of
 // type std::timed_mutex have their own try_lock_for functions, the
 // std::condition_variable::wait_for functions used in this class's push
@@ -0,0 +1,193 @@
+/**
+ * @file CallbackDispatcher.cpp
+ *
+ * The CallbackDispatcher class implementation
+ *
+ * This is part of the DUNE DAQ Application Framework, copyright 2020.
+ * Licensing/copyright details are in the COPYING file that you should have
+ * received with this code.
+ */
+
+#include "iomanager/CallbackDispatcher.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <utility>
+
+namespace dunedaq::iomanager {
+
+std::unique_ptr<CallbackDispatcher> CallbackDispatcher::s_instance = nullptr;
+
+CallbackDispatcher&
+CallbackDispatcher::get()
+{
+  if (!s_instance) {
+    s_instance.reset(new CallbackDispatcher());
+  }
+  return *s_instance;
+}
+
+CallbackDispatcher::~CallbackDispatcher()
+{
+  m_running = false;
+  m_wakeup.notify_all();
+  for (auto& worker : m_workers) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+}
+
+size_t
+CallbackDispatcher::num_workers()
+{
+  char* env = getenv("IOMANAGER_CALLBACK_THREADS");
+  if (env != nullptr) {
+    auto requested = std::stoul(env);
+    if (requested > 0) {
+      return requested;
+    }
+  }
+  auto cores = std::thread::hardware_concurrency();
+  return cores > 2 ? cores / 2 : 1;
+}
+
+void
+CallbackDispatcher::start_workers()
+{
+  if (m_running) {
+    return;
+  }
+  m_running = true;
+  auto n = num_workers();
+  for (size_t idx = 0; idx < n; ++idx) {
+    m_workers.emplace_back(&CallbackDispatcher::worker_loop, this);
+  }
+}
+
+CallbackDispatcher::handle_t
+CallbackDispatcher::register_pollable(poll_fn_t poll, int priority)
+{
+  std::lock_guard<std::mutex> lk(m_entries_mutex);
+  start_workers();
+
+  auto handle = m_next_handle++;
+  auto entry = std::make_shared<PollEntry>();
+  entry->m_poll = std::move(poll);
+  entry->m_priority = priority;
+  m_entries[handle] = entry;
+
+  m_wakeup.notify_all();
+  return handle;
+}
+
+void
+CallbackDispatcher::unregister_pollable(handle_t handle)
+{
+  std::shared_ptr<PollEntry> entry;
+  {
+    std::lock_guard<std::mutex> lk(m_entries_mutex);
+    auto it = m_entries.find(handle);
+    if (it == m_entries.end()) {
+      return;
+    }
+    entry = it->second;
+    m_entries.erase(it);
+  }
+
+  // Prevent workers from picking the entry up again, then wait until any
+  // in-flight invocation has finished
+  entry->m_active = false;
+  while (entry->m_busy.test_and_set(std::memory_order_acquire)) {
+    std::this_thread::yield();
+  }
+
+  // Drain remaining work on the calling thread, matching the old
+  // per-receiver event loop which kept popping until its queue was empty
+  while (entry->m_poll()) {
+  }
+  entry->m_busy.clear(std::memory_order_release);
+}
+
+void
+CallbackDispatcher::worker_loop()
+{
+  // Adaptive wait strategy: when sweeps keep coming back empty, first keep
+  // spinning (message bursts are picked up with minimal latency), then
+  // yield to the scheduler, then sleep for exponentially increasing
+  // intervals capped at 1 ms. Any sweep that finds work snaps the worker
+  // back to spinning.
+  constexpr int s_spin_sweeps = 64;
+  constexpr int s_yield_sweeps = 16;
+  constexpr auto s_max_sleep = std::chrono::microseconds(1000);
+
+  int idle_sweeps = 0;
+  auto sleep_time = std::chrono::microseconds(1);
+
+  std::vector<std::shared_ptr<PollEntry>> snapshot;
+
+  while (m_running) {
+    snapshot.clear();
+    {
+      std::lock_guard<std::mutex> lk(m_entries_mutex);
+      for (auto& [handle, entry] : m_entries) {
+        snapshot.push_back(entry);
+      }
+    }
+
+    // Sweep higher-priority entries first. The sort is stable, so entries
+    // of equal priority keep their registration order and stay round-robin
+    // fair with respect to each other.
+    std::stable_sort(snapshot.begin(), snapshot.end(), [](const auto& lhs, const auto& rhs) {
+      return lhs->m_priority > rhs->m_priority;
+    });
+
+    bool did_work = false;
+    for (auto& entry : snapshot) {
+      if (!m_running) {
+        break;
+      }
+      if (!entry->m_active.load()) {
+        continue;
+      }
+      if (entry->m_busy.test_and_set(std::memory_order_acquire)) {
+        continue; // another worker has it
+      }
+      // Weighted fairness: an entry with priority p gets up to p+1 polls
+      // per sweep, so high-priority connections drain faster during bursts
+      // without ever starving the rest of the sweep
+      int budget = entry->m_priority > 0 ? entry->m_priority + 1 : 1;
+      while (budget-- > 0 && entry->m_active.load() && entry->m_poll()) {
+        did_work = true;
+      }
+      entry->m_busy.clear(std::memory_order_release);
+    }
+
+    if (did_work) {
+      idle_sweeps = 0;
+      sleep_time = std::chrono::microseconds(1);
+      continue;
+    }
+
+    ++idle_sweeps;
+    if (idle_sweeps <= s_spin_sweeps) {
+      continue;
+    }
+    if (idle_sweeps <= s_spin_sweeps + s_yield_sweeps) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    {
+      std::unique_lock<std::mutex> lk(m_wakeup_mutex);
+      m_wakeup.wait_for(lk, sleep_time);
+    }
+    if (sleep_time < s_max_sleep) {
+      sleep_time *= 2;
+    }
+  }
+}
+
+} // namespace dunedaq::iomanager
@@ -8,4 +8,10 @@
 
 #include "iomanager/IOManager.hpp"
 
-std::shared_ptr<dunedaq::iomanager::IOManager> dunedaq::iomanager::IOManager::s_instance = nullptr;
\ No newline at end of file
+std::shared_ptr<dunedaq::iomanager::IOManager> dunedaq::iomanager::IOManager::s_instance = nullptr;
+std::atomic<uint64_t> dunedaq::iomanager::IOManager::s_config_epoch{ 1 };
+std::unique_ptr<dunedaq::configclient::ConfigClient> dunedaq::iomanager::IOManager::s_config_client = nullptr;
+std::mutex dunedaq::iomanager::IOManager::s_config_client_mutex;
+std::unordered_map<std::string, dunedaq::iomanager::IOManager::SourceCacheEntry>
+  dunedaq::iomanager::IOManager::s_source_cache;
+std::mutex dunedaq::iomanager::IOManager::s_source_cache_mutex;
\ No newline at end of file
@@ -10,8 +10,11 @@
 
 #include "iomanager/QueueRegistry.hpp"
 
+#include <exception>
+#include <fstream>
 #include <map>
 #include <memory>
+#include <sstream>
 #include <string>
 
 namespace dunedaq::iomanager {
@@ -34,7 +37,14 @@ QueueRegistry::configure(const std::map<std::string, QueueConfig>& config_map)
     throw QueueRegistryConfigured(ERS_HERE);
   }
 
-  m_queue_config_map = config_map;
+  // Intern the queue names: each gets a dense index into the config and
+  // instance arrays, so get_queue lookups don't walk an ordered map
+  for (const auto& [name, config] : config_map) {
+    m_queue_index[name] = m_queue_names.size();
+    m_queue_names.push_back(name);
+    m_queue_configs.push_back(config);
+  }
+  m_queue_registry.resize(m_queue_names.size());
   m_configured = true;
 }
 
@@ -42,13 +52,71 @@ void
 QueueRegistry::gather_stats(opmonlib::InfoCollector& ic, int level)
 {
 
-  for (const auto& [name, queue_entry] : m_queue_registry) {
+  for (size_t idx = 0; idx < m_queue_registry.size(); ++idx) {
+    auto& queue_entry = m_queue_registry[idx];
+    if (!queue_entry.m_instance) {
+      continue;
+    }
     opmonlib::InfoCollector tmp_ci;
     queue_entry.m_instance->get_info(tmp_ci, level);
     if (!tmp_ci.is_empty()) {
-      ic.add(name, tmp_ci);
+      ic.add(m_queue_names[idx], tmp_ci);
+    }
+  }
+}
+
+bool
+QueueRegistry::bind_thread_to_numa_node(int node, cpu_set_t& previous)
+{
+  if (sched_getaffinity(0, sizeof(previous), &previous) != 0) {
+    ers::warning(NumaPlacementFailed(ERS_HERE, node, "could not read current thread affinity"));
+    return false;
+  }
+
+  std::ifstream cpulist_file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+  if (!cpulist_file.is_open()) {
+    ers::warning(NumaPlacementFailed(ERS_HERE, node, "node has no cpulist entry in sysfs"));
+    return false;
+  }
+  std::string cpulist;
+  std::getline(cpulist_file, cpulist);
+
+  // cpulist is of the form "0-15,32-47"
+  cpu_set_t target;
+  CPU_ZERO(&target);
+  std::stringstream ss(cpulist);
+  std::string range;
+  try {
+    while (std::getline(ss, range, ',')) {
+      auto dash = range.find('-');
+      int first = std::stoi(range.substr(0, dash));
+      int last = (dash == std::string::npos) ? first : std::stoi(range.substr(dash + 1));
+      for (int cpu = first; cpu <= last; ++cpu) {
+        CPU_SET(cpu, &target); // NOLINT
+      }
     }
+  } catch (std::exception const&) {
+    // A malformed cpulist falls back like every other placement failure
+    // instead of letting std::stoi abort queue creation
+    ers::warning(NumaPlacementFailed(ERS_HERE, node, "could not parse node cpulist \"" + cpulist + "\""));
+    return false;
+  }
+  if (CPU_COUNT(&target) == 0) {
+    ers::warning(NumaPlacementFailed(ERS_HERE, node, "node cpulist \"" + cpulist + "\" is empty"));
+    return false;
+  }
+
+  if (sched_setaffinity(0, sizeof(target), &target) != 0) {
+    ers::warning(NumaPlacementFailed(ERS_HERE, node, "could not bind thread to node cpus"));
+    return false;
   }
+  return true;
+}
+
+void
+QueueRegistry::restore_thread_affinity(const cpu_set_t& previous)
+{
+  sched_setaffinity(0, sizeof(previous), &previous);
 }
 
 QueueConfig::queue_kind
@@ -58,8 +126,12 @@ QueueConfig::stoqk(const std::string& name)
     return queue_kind::kStdDeQueue;
   else if (name.find("SPSC") != std::string::npos)
     return queue_kind::kFollySPSCQueue;
+  else if (name.find("MPSC") != std::string::npos)
+    return queue_kind::kFollyMPSCQueue;
   else if (name.find("MPMC") != std::string::npos)
     return queue_kind::kFollyMPMCQueue;
+  else if (name.find("Unbounded") != std::string::npos)
+    return queue_kind::kFollyUnboundedQueue;
   else
     throw QueueKindUnknown(ERS_HERE, name);
 }
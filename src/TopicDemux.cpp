@@ -0,0 +1,166 @@
+/**
+ * @file TopicDemux.cpp TopicDemux class implementation
+ *
+ * This is part of the DUNE DAQ Application Framework, copyright 2020.
+ * Licensing/copyright details are in the COPYING file that you should have
+ * received with this code.
+ */
+
+#include "iomanager/TopicDemux.hpp"
+
+#include "iomanager/MessageFraming.hpp"
+
+#include "logging/Logging.hpp"
+
+#include <cstdlib>
+#include <utility>
+
+namespace dunedaq {
+namespace iomanager {
+
+std::map<std::string, std::shared_ptr<TopicDemux>> TopicDemux::s_instances;
+std::mutex TopicDemux::s_instances_mutex;
+
+bool
+TopicDemux::enabled()
+{
+  // Only consulted when senders and receivers are constructed, so no
+  // caching is needed
+  return getenv("IOMANAGER_TOPIC_DEMUX") != nullptr; // NOLINT(concurrency-mt-unsafe)
+}
+
+std::shared_ptr<TopicDemux>
+TopicDemux::get(std::string const& conn_uid, std::shared_ptr<ipm::Subscriber> subscriber)
+{
+  std::lock_guard<std::mutex> lk(s_instances_mutex);
+  auto it = s_instances.find(conn_uid);
+  if (it != s_instances.end()) {
+    return it->second;
+  }
+  auto instance = std::make_shared<TopicDemux>(conn_uid, subscriber);
+  s_instances[conn_uid] = instance;
+  return instance;
+}
+
+void
+TopicDemux::reset()
+{
+  std::lock_guard<std::mutex> lk(s_instances_mutex);
+  // Stop every reader before dropping the map: user code holding a
+  // receiver (and through it a shared_ptr to the demux) past reset()
+  // would otherwise keep the reader polling a socket that
+  // NetworkManager::reset() is about to tear down
+  for (auto& [uid, instance] : s_instances) {
+    instance->stop();
+  }
+  s_instances.clear();
+}
+
+TopicDemux::TopicDemux(std::string conn_uid, std::shared_ptr<ipm::Subscriber> subscriber)
+  : m_conn_uid(std::move(conn_uid))
+  , m_subscriber(subscriber)
+{
+  TLOG() << "TopicDemux created for connection " << m_conn_uid;
+}
+
+TopicDemux::~TopicDemux()
+{
+  stop();
+}
+
+void
+TopicDemux::stop()
+{
+  if (m_running.exchange(false) && m_reader.joinable()) {
+    m_reader.join();
+  }
+}
+
+std::shared_ptr<TopicDemux::topic_queue_t>
+TopicDemux::subscribe(std::string const& topic)
+{
+  std::lock_guard<std::mutex> lk(m_mutex);
+  auto it = m_queues.find(topic);
+  if (it != m_queues.end()) {
+    return it->second;
+  }
+  auto queue = std::make_shared<topic_queue_t>(s_topic_queue_capacity);
+  m_queues[topic] = queue;
+  if (!m_running.exchange(true)) {
+    m_reader = std::thread(&TopicDemux::reader_loop, this);
+  }
+  return queue;
+}
+
+void
+TopicDemux::reader_loop()
+{
+  // A short blocking receive keeps the reader responsive to shutdown
+  // without spinning when the connection is idle
+  static constexpr std::chrono::milliseconds s_reader_timeout{ 10 };
+  while (m_running.load()) {
+    try {
+      auto response = m_subscriber->receive(s_reader_timeout, ipm::Receiver::s_any_size, true);
+      if (response.data.size() == 0) {
+        continue;
+      }
+      route(std::move(response.data));
+    } catch (ers::Issue const& ex) {
+      // A transport error must not escape the thread body and terminate
+      // the process; report it and pace the retry so a persistently
+      // broken socket does not turn this loop into a warning firehose
+      ers::warning(ex);
+      std::this_thread::sleep_for(s_reader_timeout);
+    }
+  }
+}
+
+void
+TopicDemux::route(buffer_t&& data)
+{
+  // Coalesced aggregates carry one topic frame per message, so each part
+  // is routed individually
+  if (framing::is_coalesced_frame(data)) {
+    auto parts = framing::split_coalesced_frame(data);
+    for (auto& part : parts) {
+      route(std::move(part));
+    }
+    return;
+  }
+  if (!framing::is_topic_frame(data)) {
+    // Without an embedded topic there is nothing to route by; the sender
+    // side is not running topic framing (or this is chunked traffic,
+    // which the demux does not support)
+    note_drop();
+    return;
+  }
+  auto topic = framing::topic_of_frame(data);
+  auto offset = framing::topic_frame_payload_offset(data);
+  buffer_t payload(data.begin() + offset, data.end());
+
+  std::shared_ptr<topic_queue_t> queue;
+  {
+    std::lock_guard<std::mutex> lk(m_mutex);
+    auto it = m_queues.find(topic);
+    if (it != m_queues.end()) {
+      queue = it->second;
+    }
+  }
+  if (queue == nullptr || !queue->try_enqueue(std::move(payload))) {
+    note_drop();
+  }
+}
+
+void
+TopicDemux::note_drop()
+{
+  // Report at exponentially spaced counts so a stuck consumer cannot turn
+  // the drop reporting itself into a hot path
+  auto count = m_dropped.fetch_add(1, std::memory_order_relaxed) + 1;
+  if ((count & (count - 1)) == 0) {
+    ers::warning(DemuxMessageDropped(ERS_HERE, m_conn_uid, count));
+  }
+}
+
+} // namespace iomanager
+} // namespace dunedaq
@@ -0,0 +1,158 @@
+/**
+ * @file CallbackDispatcher_test.cxx CallbackDispatcher Unit Tests
+ *
+ * This is part of the DUNE DAQ Application Framework, copyright 2021.
+ * Licensing/copyright details are in the COPYING file that you should have
+ * received with this code.
+ */
+
+#include "iomanager/CallbackDispatcher.hpp"
+
+#define BOOST_TEST_MODULE CallbackDispatcher_test // NOLINT
+
+#include "boost/test/unit_test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+
+using namespace dunedaq::iomanager;
+
+BOOST_AUTO_TEST_SUITE(CallbackDispatcher_test)
+
+struct DispatcherTestFixture
+{
+  DispatcherTestFixture() {}
+  ~DispatcherTestFixture() { CallbackDispatcher::reset(); }
+
+  DispatcherTestFixture(DispatcherTestFixture const&) = default;
+  DispatcherTestFixture(DispatcherTestFixture&&) = default;
+  DispatcherTestFixture& operator=(DispatcherTestFixture const&) = default;
+  DispatcherTestFixture& operator=(DispatcherTestFixture&&) = default;
+};
+
+BOOST_AUTO_TEST_CASE(CopyAndMoveSemantics)
+{
+  BOOST_REQUIRE(!std::is_copy_constructible_v<CallbackDispatcher>);
+  BOOST_REQUIRE(!std::is_copy_assignable_v<CallbackDispatcher>);
+  BOOST_REQUIRE(!std::is_move_constructible_v<CallbackDispatcher>);
+  BOOST_REQUIRE(!std::is_move_assignable_v<CallbackDispatcher>);
+}
+
+BOOST_FIXTURE_TEST_CASE(PollableIsInvoked, DispatcherTestFixture)
+{
+  std::atomic<int> budget{ 5 };
+  std::atomic<int> calls{ 0 };
+
+  auto handle = CallbackDispatcher::get().register_pollable([&]() {
+    if (budget > 0) {
+      --budget;
+      ++calls;
+      return true;
+    }
+    return false;
+  });
+  BOOST_REQUIRE(handle != 0);
+
+  while (calls.load() < 5) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  CallbackDispatcher::get().unregister_pollable(handle);
+  BOOST_CHECK_EQUAL(calls.load(), 5);
+}
+
+BOOST_FIXTURE_TEST_CASE(UnregisterDrains, DispatcherTestFixture)
+{
+  std::atomic<int> pending{ 100 };
+  std::atomic<int> processed{ 0 };
+
+  auto handle = CallbackDispatcher::get().register_pollable([&]() {
+    if (pending > 0) {
+      --pending;
+      ++processed;
+      return true;
+    }
+    return false;
+  });
+
+  // Unregistering must drain all remaining "work" before returning
+  CallbackDispatcher::get().unregister_pollable(handle);
+  BOOST_CHECK_EQUAL(pending.load(), 0);
+  BOOST_CHECK_EQUAL(processed.load(), 100);
+
+  // Unregistering twice is a no-op
+  CallbackDispatcher::get().unregister_pollable(handle);
+}
+
+BOOST_FIXTURE_TEST_CASE(PriorityWeighting, DispatcherTestFixture)
+{
+  // A single worker makes the sweep schedule deterministic: per sweep the
+  // high-priority entry gets priority+1 polls and the low-priority one gets
+  // one poll
+  setenv("IOMANAGER_CALLBACK_THREADS", "1", 1);
+
+  std::atomic<int> high_pending{ 80 };
+  std::atomic<int> low_processed{ 0 };
+  std::atomic<int> low_processed_at_high_drain{ -1 };
+
+  auto low_handle = CallbackDispatcher::get().register_pollable(
+    [&]() {
+      if (low_processed < 1000) {
+        ++low_processed;
+        return true;
+      }
+      return false;
+    },
+    0);
+
+  auto high_handle = CallbackDispatcher::get().register_pollable(
+    [&]() {
+      if (high_pending > 0) {
+        if (--high_pending == 0) {
+          low_processed_at_high_drain = low_processed.load();
+        }
+        return true;
+      }
+      return false;
+    },
+    7);
+
+  while (high_pending.load() > 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  CallbackDispatcher::get().unregister_pollable(high_handle);
+  CallbackDispatcher::get().unregister_pollable(low_handle);
+  unsetenv("IOMANAGER_CALLBACK_THREADS");
+
+  // 80 high-priority messages at 8 polls per sweep take ~10 sweeps, during
+  // which the low-priority entry is polled about once per sweep. Allow a
+  // generous margin for sweep boundaries
+  BOOST_CHECK_LE(low_processed_at_high_drain.load(), 30);
+}
+
+BOOST_FIXTURE_TEST_CASE(ManyPollables, DispatcherTestFixture)
+{
+  constexpr int n_pollables = 50;
+  std::vector<CallbackDispatcher::handle_t> handles;
+  std::atomic<int> total{ 0 };
+
+  for (int idx = 0; idx < n_pollables; ++idx) {
+    handles.push_back(CallbackDispatcher::get().register_pollable([&total]() {
+      ++total;
+      return false;
+    }));
+  }
+
+  while (total.load() < n_pollables) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  for (auto handle : handles) {
+    CallbackDispatcher::get().unregister_pollable(handle);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -14,7 +14,10 @@
 
 #include "boost/test/unit_test.hpp"
 
+#include <algorithm>
+#include <cstdlib>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -102,11 +105,22 @@ struct NonSerializableNonCopyable
   NonSerializableNonCopyable& operator=(NonSerializableNonCopyable&&) = default;
 };
 
+struct RawData
+{
+  int d1;
+  double d2;
+
+  DUNE_DAQ_SERIALIZE(RawData, d1, d2);
+};
+static_assert(std::is_trivially_copyable_v<RawData>,
+              "RawData must stay trivially copyable to exercise the raw serialization fast path");
+
 } // namespace iomanager
 
 // Must be in dunedaq namespace only
 DUNE_DAQ_SERIALIZABLE(iomanager::Data);
 DUNE_DAQ_SERIALIZABLE(iomanager::NonCopyableData);
+DUNE_DAQ_SERIALIZABLE(iomanager::RawData);
 
 } // namespace dunedaq
 
@@ -268,6 +282,216 @@ BOOST_FIXTURE_TEST_CASE(SimpleSendReceive, ConfigurationTestFixture)
   BOOST_CHECK_EQUAL(ret.d3, "test2");
 }
 
+BOOST_FIXTURE_TEST_CASE(BatchSendReceive, ConfigurationTestFixture)
+{
+  auto net_sender = IOManager::get()->get_sender<Data>(conn_ref_s);
+  auto net_receiver = IOManager::get()->get_receiver<Data>(conn_ref_r);
+  auto q_sender = IOManager::get()->get_sender<Data>(queue_ref);
+  auto q_receiver = IOManager::get()->get_receiver<Data>(queue_ref);
+
+  std::vector<Data> batch_nw;
+  std::vector<Data> batch_q;
+  for (int i = 0; i < 5; ++i) {
+    batch_nw.emplace_back(Data(i, i + 0.5, "nw"));
+    batch_q.emplace_back(Data(i, i + 0.5, "q"));
+  }
+
+  net_sender->send_batch(std::move(batch_nw), dunedaq::iomanager::Sender::s_no_block);
+  auto ret_nw = net_receiver->receive_batch(10, std::chrono::milliseconds(10));
+  BOOST_REQUIRE_EQUAL(ret_nw.size(), 5);
+  BOOST_CHECK_EQUAL(ret_nw[0].d1, 0);
+  BOOST_CHECK_EQUAL(ret_nw[4].d1, 4);
+  BOOST_CHECK_EQUAL(ret_nw[4].d3, "nw");
+
+  q_sender->send_batch(std::move(batch_q), std::chrono::milliseconds(10));
+  auto ret_q = q_receiver->receive_batch(3, std::chrono::milliseconds(10));
+  BOOST_REQUIRE_EQUAL(ret_q.size(), 3);
+  BOOST_CHECK_EQUAL(ret_q[2].d1, 2);
+  BOOST_CHECK_EQUAL(ret_q[2].d3, "q");
+
+  ret_q = q_receiver->receive_batch(10, std::chrono::milliseconds(10));
+  BOOST_REQUIRE_EQUAL(ret_q.size(), 2);
+}
+
+BOOST_FIXTURE_TEST_CASE(AsyncSendReceive, ConfigurationTestFixture)
+{
+  auto net_sender = IOManager::get()->get_sender<Data>(conn_ref_s);
+  auto net_receiver = IOManager::get()->get_receiver<Data>(conn_ref_r);
+  auto q_sender = IOManager::get()->get_sender<Data>(queue_ref);
+  auto q_receiver = IOManager::get()->get_receiver<Data>(queue_ref);
+
+  auto nw_future = net_sender->send_async(Data(61, 61.5, "async_nw"), std::chrono::milliseconds(10));
+  auto q_future = q_sender->send_async(Data(62, 62.5, "async_q"), std::chrono::milliseconds(10));
+  nw_future.get();
+  q_future.get();
+
+  auto ret_nw = net_receiver->receive(std::chrono::milliseconds(10));
+  BOOST_CHECK_EQUAL(ret_nw.d1, 61);
+  BOOST_CHECK_EQUAL(ret_nw.d3, "async_nw");
+
+  auto ret_q = q_receiver->receive(std::chrono::milliseconds(10));
+  BOOST_CHECK_EQUAL(ret_q.d1, 62);
+  BOOST_CHECK_EQUAL(ret_q.d3, "async_q");
+}
+
+BOOST_FIXTURE_TEST_CASE(ChunkedSendReceive, ConfigurationTestFixture)
+{
+  // Small chunk size so a modest message is streamed as many chunks
+  setenv("IOMANAGER_CHUNK_BYTES", "64", 1);
+
+  auto net_sender = IOManager::get()->get_sender<Data>(conn_ref_s);
+  auto net_receiver = IOManager::get()->get_receiver<Data>(conn_ref_r);
+
+  std::string large_payload(1000, 'x');
+  net_sender->send(Data(81, 81.5, large_payload), std::chrono::milliseconds(10));
+
+  auto ret = net_receiver->receive(std::chrono::milliseconds(10));
+  BOOST_CHECK_EQUAL(ret.d1, 81);
+  BOOST_CHECK_EQUAL(ret.d2, 81.5);
+  BOOST_CHECK_EQUAL(ret.d3, large_payload);
+
+  // A message that fits in one chunk takes the plain, unframed path
+  net_sender->send(Data(82, 82.5, "small"), std::chrono::milliseconds(10));
+  ret = net_receiver->receive(std::chrono::milliseconds(10));
+  BOOST_CHECK_EQUAL(ret.d1, 82);
+  BOOST_CHECK_EQUAL(ret.d3, "small");
+
+  unsetenv("IOMANAGER_CHUNK_BYTES");
+}
+
+BOOST_AUTO_TEST_CASE(TopicDemuxPubSub)
+{
+  setenv("IOMANAGER_TOPIC_DEMUX", "1", 1);
+
+  ConnectionIds_t connections;
+  connections.emplace_back(ConnectionId{
+    "demux_pub", ServiceType::kPublisher, "Data", "inproc://demux", { "demux_topic_1", "demux_topic_2" } });
+  connections.emplace_back(ConnectionId{
+    "demux_sub", ServiceType::kSubscriber, "Data", "inproc://demux", { "demux_topic_1", "demux_topic_2" } });
+  IOManager::get()->configure(connections);
+
+  auto pub_sender = IOManager::get()->get_sender<Data>(ConnectionRef{ "pub", "demux_pub", Direction::kOutput });
+  // Both topic-level receivers share the connection's one socket; the
+  // TopicDemux reader routes messages between them
+  auto sub1_receiver = IOManager::get()->get_receiver<Data>(ConnectionRef{ "sub1", "demux_topic_1", Direction::kInput });
+  auto sub2_receiver = IOManager::get()->get_receiver<Data>(ConnectionRef{ "sub2", "demux_topic_2", Direction::kInput });
+
+  pub_sender->send(Data(91, 91.5, "first"), std::chrono::milliseconds(10), "demux_topic_1");
+  pub_sender->send(Data(92, 92.5, "second"), std::chrono::milliseconds(10), "demux_topic_2");
+
+  // Each receiver only sees its own topic's messages
+  auto ret1 = sub1_receiver->receive(std::chrono::milliseconds(100));
+  BOOST_CHECK_EQUAL(ret1.d1, 91);
+  BOOST_CHECK_EQUAL(ret1.d2, 91.5);
+  BOOST_CHECK_EQUAL(ret1.d3, "first");
+  auto ret2 = sub2_receiver->receive(std::chrono::milliseconds(100));
+  BOOST_CHECK_EQUAL(ret2.d1, 92);
+  BOOST_CHECK_EQUAL(ret2.d2, 92.5);
+  BOOST_CHECK_EQUAL(ret2.d3, "second");
+
+  BOOST_REQUIRE_EXCEPTION(
+    sub1_receiver->receive(std::chrono::milliseconds(10)), TimeoutExpired, [](TimeoutExpired const&) { return true; });
+
+  IOManager::get()->reset();
+  unsetenv("IOMANAGER_TOPIC_DEMUX");
+}
+
+BOOST_AUTO_TEST_CASE(StripedSendReceive)
+{
+  ConnectionIds_t connections;
+  connections.emplace_back(
+    ConnectionId{ "striped_connection_r", ServiceType::kNetReceiver, "Data", "inproc://stripe0,inproc://stripe1" });
+  connections.emplace_back(
+    ConnectionId{ "striped_connection_s", ServiceType::kNetSender, "Data", "inproc://stripe0,inproc://stripe1" });
+  IOManager::get()->configure(connections);
+
+  auto sender =
+    IOManager::get()->get_sender<Data>(ConnectionRef{ "striped_s", "striped_connection_s", Direction::kOutput });
+  auto receiver =
+    IOManager::get()->get_receiver<Data>(ConnectionRef{ "striped_r", "striped_connection_r", Direction::kInput });
+
+  // Messages round-robin across the stripes; ordering across stripes is
+  // not guaranteed, so collect and sort
+  for (int idx = 0; idx < 4; ++idx) {
+    sender->send(Data(idx, idx + 0.5, "striped"), std::chrono::milliseconds(10));
+  }
+  std::vector<int> received;
+  for (int idx = 0; idx < 4; ++idx) {
+    auto ret = receiver->receive(std::chrono::milliseconds(100));
+    BOOST_CHECK_EQUAL(ret.d3, "striped");
+    received.push_back(ret.d1);
+  }
+  std::sort(received.begin(), received.end());
+  for (int idx = 0; idx < 4; ++idx) {
+    BOOST_CHECK_EQUAL(received[idx], idx);
+  }
+
+  BOOST_REQUIRE_EXCEPTION(
+    receiver->receive(std::chrono::milliseconds(10)), TimeoutExpired, [](TimeoutExpired const&) { return true; });
+
+  IOManager::get()->reset();
+}
+
+BOOST_AUTO_TEST_CASE(RawSerialization)
+{
+  ConnectionIds_t connections;
+  connections.emplace_back(
+    ConnectionId{ "raw_connection_r", ServiceType::kNetReceiver, "RawData", "inproc://raw", {}, SerializationFormat::kRaw });
+  connections.emplace_back(
+    ConnectionId{ "raw_connection_s", ServiceType::kNetSender, "RawData", "inproc://raw", {}, SerializationFormat::kRaw });
+  IOManager::get()->configure(connections);
+
+  auto sender = IOManager::get()->get_sender<RawData>(ConnectionRef{ "raw_s", "raw_connection_s", Direction::kOutput });
+  auto receiver =
+    IOManager::get()->get_receiver<RawData>(ConnectionRef{ "raw_r", "raw_connection_r", Direction::kInput });
+
+  sender->send(RawData{ 101, 101.5 }, std::chrono::milliseconds(10));
+  auto ret = receiver->receive(std::chrono::milliseconds(10));
+  BOOST_CHECK_EQUAL(ret.d1, 101);
+  BOOST_CHECK_EQUAL(ret.d2, 101.5);
+
+  IOManager::get()->reset();
+}
+
+BOOST_FIXTURE_TEST_CASE(PooledReceive, ConfigurationTestFixture)
+{
+  auto q_sender = IOManager::get()->get_sender<Data>(queue_ref);
+  auto q_receiver = IOManager::get()->get_receiver<Data>(queue_ref);
+
+  q_sender->send(Data(71, 71.5, "pooled"), std::chrono::milliseconds(10));
+
+  auto obj = q_receiver->pool().acquire();
+  q_receiver->receive_into(obj, std::chrono::milliseconds(10));
+  BOOST_CHECK_EQUAL(obj.d1, 71);
+  BOOST_CHECK_EQUAL(obj.d3, "pooled");
+  q_receiver->pool().release(std::move(obj));
+  BOOST_CHECK_EQUAL(q_receiver->pool().size(), 1);
+
+  // The recycled instance is handed back out
+  auto recycled = q_receiver->pool().acquire();
+  BOOST_CHECK_EQUAL(q_receiver->pool().size(), 0);
+  BOOST_REQUIRE_EXCEPTION(q_receiver->receive_into(recycled, std::chrono::milliseconds(10)),
+                          TimeoutExpired,
+                          [&](TimeoutExpired) { return true; });
+}
+
+BOOST_FIXTURE_TEST_CASE(DirectQueueHandles, ConfigurationTestFixture)
+{
+  auto direct_sender = IOManager::get()->get_direct_sender<Data, StdDeQueue>("test_queue");
+  auto direct_receiver = IOManager::get()->get_direct_receiver<Data, StdDeQueue>("test_queue");
+
+  direct_sender.send(Data(81, 81.5, "direct"), std::chrono::milliseconds(10));
+  auto ret = direct_receiver.receive(std::chrono::milliseconds(10));
+  BOOST_CHECK_EQUAL(ret.d1, 81);
+  BOOST_CHECK_EQUAL(ret.d3, "direct");
+
+  // Asking for the wrong queue kind is a configuration error, not a
+  // silently-degraded handle
+  BOOST_REQUIRE_EXCEPTION((IOManager::get()->get_direct_sender<Data, FollySPSCQueue>("test_queue")),
+                          DirectBindingMismatch,
+                          [&](DirectBindingMismatch) { return true; });
+}
+
 BOOST_FIXTURE_TEST_CASE(GetByName, ConfigurationTestFixture)
 {
   auto net_sender = IOManager::get()->get_sender<Data>("test_connection_s");
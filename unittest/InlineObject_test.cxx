@@ -0,0 +1,100 @@
+/**
+ * @file InlineObject_test.cxx InlineObject class Unit Tests
+ *
+ * This is part of the DUNE DAQ Application Framework, copyright 2020.
+ * Licensing/copyright details are in the COPYING file that you should have
+ * received with this code.
+ */
+
+#include "iomanager/InlineObject.hpp"
+#include "iomanager/StdDeQueue.hpp"
+
+#define BOOST_TEST_MODULE InlineObject_test // NOLINT
+#include "boost/test/included/unit_test.hpp"
+
+#include <chrono>
+#include <string>
+#include <utility>
+
+using namespace dunedaq::iomanager;
+
+BOOST_AUTO_TEST_SUITE(InlineObject_test)
+
+namespace {
+
+struct Payload
+{
+  Payload() = default;
+  Payload(int v, std::string s)
+    : value(v)
+    , label(std::move(s))
+  {}
+  int value{ 0 };
+  std::string label;
+};
+
+constexpr auto timeout = std::chrono::milliseconds(5);
+
+} // namespace ""
+
+BOOST_AUTO_TEST_CASE(StorageSelection)
+{
+  BOOST_REQUIRE(InlineObject<Payload>::s_stores_inline);
+  BOOST_REQUIRE(!(InlineObject<Payload, 4>::s_stores_inline));
+  BOOST_REQUIRE(!std::is_copy_constructible_v<InlineObject<Payload>>);
+}
+
+BOOST_AUTO_TEST_CASE(PointerSemantics)
+{
+  InlineObject<Payload> empty;
+  BOOST_REQUIRE(!empty);
+  BOOST_REQUIRE(empty.get() == nullptr);
+
+  auto obj = make_inline_object<Payload>(42, "inline");
+  BOOST_REQUIRE(!!obj);
+  BOOST_CHECK_EQUAL(obj->value, 42);
+  BOOST_CHECK_EQUAL((*obj).label, "inline");
+
+  // Moving empties the source, like a unique_ptr
+  auto moved = std::move(obj);
+  BOOST_REQUIRE(!obj);
+  BOOST_REQUIRE(!!moved);
+  BOOST_CHECK_EQUAL(moved->value, 42);
+
+  moved.reset();
+  BOOST_REQUIRE(!moved);
+}
+
+BOOST_AUTO_TEST_CASE(HeapFallback)
+{
+  // Payload is larger than the 4-byte inline limit, so storage falls
+  // back to the heap with identical semantics
+  auto obj = make_inline_object<Payload, 4>(7, "heap");
+  BOOST_REQUIRE(!!obj);
+  BOOST_CHECK_EQUAL(obj->value, 7);
+
+  auto moved = std::move(obj);
+  BOOST_REQUIRE(!obj);
+  BOOST_CHECK_EQUAL(moved->label, "heap");
+}
+
+BOOST_AUTO_TEST_CASE(QueueHandoff)
+{
+  // The payload rides in the ring slot itself: push moves it into queue
+  // memory, pop moves it back out
+  StdDeQueue<InlineObject<Payload>> queue("inline_queue", 10);
+
+  queue.push(make_inline_object<Payload>(1, "first"), timeout);
+  queue.push(make_inline_object<Payload>(2, "second"), timeout);
+
+  InlineObject<Payload> popped;
+  queue.pop(popped, timeout);
+  BOOST_REQUIRE(!!popped);
+  BOOST_CHECK_EQUAL(popped->value, 1);
+  BOOST_CHECK_EQUAL(popped->label, "first");
+
+  queue.pop(popped, timeout);
+  BOOST_CHECK_EQUAL(popped->value, 2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
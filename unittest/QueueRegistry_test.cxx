@@ -36,6 +36,12 @@ BOOST_AUTO_TEST_CASE(Configure)
   qc.kind = QueueConfig::kFollyMPMCQueue;
   qc.capacity = 10;
   test_map["test_queue_fmpmc"] = qc;
+  qc.kind = QueueConfig::kFollyMPSCQueue;
+  qc.capacity = 10;
+  test_map["test_queue_fmpsc"] = qc;
+  qc.kind = QueueConfig::kFollyUnboundedQueue;
+  qc.capacity = 10;
+  test_map["test_queue_funbounded"] = qc;
 
   QueueRegistry::get().configure(test_map);
 
@@ -48,6 +54,8 @@ BOOST_AUTO_TEST_CASE(StoQK)
   BOOST_REQUIRE_EQUAL(QueueConfig::stoqk("StdDeQueue"), QueueConfig::kStdDeQueue);
   BOOST_REQUIRE_EQUAL(QueueConfig::stoqk("FollySPSCQueue"), QueueConfig::kFollySPSCQueue);
   BOOST_REQUIRE_EQUAL(QueueConfig::stoqk("FollyMPMCQueue"), QueueConfig::kFollyMPMCQueue);
+  BOOST_REQUIRE_EQUAL(QueueConfig::stoqk("FollyMPSCQueue"), QueueConfig::kFollyMPSCQueue);
+  BOOST_REQUIRE_EQUAL(QueueConfig::stoqk("FollyUnboundedQueue"), QueueConfig::kFollyUnboundedQueue);
   BOOST_REQUIRE_EXCEPTION(QueueConfig::stoqk("blahblahblah"), QueueKindUnknown, [&](QueueKindUnknown) { return true; });
 }
 
@@ -72,6 +80,10 @@ BOOST_AUTO_TEST_CASE(CreateQueue)
   BOOST_REQUIRE(queue_ptr_fspsc != nullptr);
   auto queue_ptr_fmpmc = QueueRegistry::get().get_queue<int>("test_queue_fmpmc");
   BOOST_REQUIRE(queue_ptr_fmpmc != nullptr);
+  auto queue_ptr_fmpsc = QueueRegistry::get().get_queue<int>("test_queue_fmpsc");
+  BOOST_REQUIRE(queue_ptr_fmpsc != nullptr);
+  auto queue_ptr_funbounded = QueueRegistry::get().get_queue<int>("test_queue_funbounded");
+  BOOST_REQUIRE(queue_ptr_funbounded != nullptr);
   BOOST_REQUIRE_EXCEPTION(QueueRegistry::get().get_queue<int>("test_queue_unknown"),
                           QueueKindUnknown,
                           [&](QueueKindUnknown) { return true; });
@@ -13,6 +13,8 @@
 #include "boost/test/included/unit_test.hpp"
 
 #include <chrono>
+#include <utility>
+#include <vector>
 
 BOOST_AUTO_TEST_SUITE(StdDeQueue_test)
 
@@ -130,4 +132,31 @@ BOOST_AUTO_TEST_CASE(empty_checks)
   BOOST_CHECK_LT(fraction_of_pop_timeout_used, 1 + fractional_timeout_tolerance);
 }
 
+BOOST_AUTO_TEST_CASE(bulk_checks, *boost::unit_test::depends_on("StdDeQueue_test/empty_checks"))
+{
+  std::vector<int> values_to_push{ 0, 1, 2, 3, 4 };
+  queue.push_bulk(std::move(values_to_push), timeout);
+  BOOST_REQUIRE_EQUAL(queue.get_num_elements(), 5);
+
+  std::vector<int> popped_values;
+  auto n_popped = queue.pop_bulk(popped_values, 3, timeout);
+  BOOST_REQUIRE_EQUAL(n_popped, 3);
+  BOOST_REQUIRE_EQUAL(popped_values.size(), 3);
+  BOOST_CHECK_EQUAL(popped_values[0], 0);
+  BOOST_CHECK_EQUAL(popped_values[2], 2);
+
+  // Asking for more than is available returns what's there
+  n_popped = queue.pop_bulk(popped_values, 10, timeout);
+  BOOST_REQUIRE_EQUAL(n_popped, 2);
+  BOOST_CHECK_EQUAL(popped_values[0], 3);
+  BOOST_CHECK_EQUAL(popped_values[1], 4);
+
+  BOOST_REQUIRE(!queue.can_pop());
+
+  // A batch larger than the remaining space must time out rather than
+  // deadlock on the held lock
+  std::vector<int> oversized(queue.get_capacity() + 1, 1);
+  BOOST_CHECK_THROW(queue.push_bulk(std::move(oversized), timeout), dunedaq::iomanager::QueueTimeoutExpired);
+}
+
 BOOST_AUTO_TEST_SUITE_END()